@@ -14,11 +14,26 @@
 #include "web_config.h"
 #include "message.h"
 #include "image.h"     // <-- add this for image support
+#include "render_pipe.h"
 #include "time.h"
 #include <HTTPClient.h>
 #include <ArduinoJson.h>
 #include "web_fileman.h"
 #include "web_message.h"
+#include "web_upload.h"
+#include "display_owner.h"
+#include "outbound.h"
+#include "telemetry.h"
+#include "file_index.h"
+#include "thumbs.h"
+#include "metrics.h"
+#include "sd_stats.h"
+#include "boot_profile.h"
+#include "timesync.h"
+#include "endpoint.h"
+#include "sd_bench.h"
+#include "psram_pool.h"
+#include "ledfx.h"
 
 #define PINK  display.color565(255, 105, 180)
 #define WHITE 0xFFFF
@@ -26,47 +41,68 @@
 
 extern AsyncWebServer server;
 
-// --- GLOBAL display lock ---
-volatile bool g_displayLock = false;
-static unsigned long messageShownAt = 0;
-static unsigned long messageLockDuration = 3500; // 3.5 seconds
+// How long a received message/image stays up before loop() may redraw
+static const unsigned long messageLockDuration = 3500; // 3.5 seconds
+
+// Boot: minimum splash time, and how long setup() gives Wi-Fi to come up
+#define BOOT_SPLASH_MS     2000
+#define BOOT_WIFI_WAIT_MS  7000
 
 // --- DEVICE CHECK-IN PATCH ---
 void checkInWithServer() {
-  DeviceConfig& cfg = Config::get();
-  if (cfg.serverAddress.isEmpty() || cfg.deviceName.isEmpty()) {
-    return;
-  }
-  String url = "http://" + cfg.serverAddress + ":6969/api/checkin";
-  String payload = "{\"device_id\":\"" + cfg.deviceName + "\"}";
+  const Endpoint::Server ep = Endpoint::get();
+  if (!ep.valid) return;
   HTTPClient http;
-  http.begin(url);
+  http.begin(ep.checkinUrl);
   http.addHeader("Content-Type", "application/json");
-  http.POST(payload);
+  http.POST((uint8_t*)ep.deviceBody, ep.deviceBodyLen);
   http.end();
 }
 
-// --- SERVER MESSAGE PULL PATCH ---
-void pullMessagesFromServer() {
-  DeviceConfig& cfg = Config::get();
-  if (cfg.serverAddress.isEmpty() || cfg.deviceName.isEmpty()) {
-    return;
+// Pull replies land here rather than in a growing String
+#define PULL_REPLY_MAX 4096
+static char pullReply[PULL_REPLY_MAX];
+// The reply is parsed in place, so the document only holds its nodes: room
+// for the message fields plus one full inline ledFx track
+#define PULL_DOC_SIZE  (2048 + LEDFX_DOC_SIZE)
+
+struct ReplyBuffer : Print {
+  size_t len = 0;
+  bool overflow = false;
+  size_t write(uint8_t c) override { return write(&c, 1); }
+  size_t write(const uint8_t* p, size_t n) override {
+    if (len + n >= PULL_REPLY_MAX) { overflow = true; return n; }   // drain, but drop
+    memcpy(pullReply + len, p, n);
+    len += n;
+    return n;
   }
+};
 
-  String url = "http://" + cfg.serverAddress + ":6969/api/pull";
-  String payload = "{\"device_id\":\"" + cfg.deviceName + "\"}";
+// --- SERVER MESSAGE PULL PATCH ---
+void pullMessagesFromServer() {
+  const Endpoint::Server ep = Endpoint::get();
+  if (!ep.valid) return;
 
+  unsigned long t0 = millis();
   HTTPClient http;
-  http.begin(url);
+  http.begin(ep.pullUrl);
   http.addHeader("Content-Type", "application/json");
 
-  int httpCode = http.POST(payload);
+  int httpCode = http.POST((uint8_t*)ep.deviceBody, ep.deviceBodyLen);
+  Metrics::inc(Metrics::Counter::Pulls);
 
   if (httpCode == 200) {
-    String response = http.getString();
-    StaticJsonDocument<2048> doc;
-    DeserializationError err = deserializeJson(doc, response);
+    ReplyBuffer reply;
+    http.writeToStream(&reply);
+    pullReply[reply.len] = 0;
+    Metrics::observe(Metrics::Hist::PullMs, millis() - t0);
+    Metrics::inc(Metrics::Counter::PullBytes, reply.len);
+    if (reply.overflow) Serial.printf("[Pull] Reply over %d bytes dropped\n", PULL_REPLY_MAX);
+    PoolJsonDocument doc(PULL_DOC_SIZE);
+    DeserializationError err = reply.overflow ? DeserializationError(DeserializationError::NoMemory)
+                                              : deserializeJson(doc, pullReply, reply.len);
     if (!err && doc["messages"].is<JsonArray>()) {
+      Metrics::observe(Metrics::Hist::PullMessages, doc["messages"].size());
       for (JsonObject msg : doc["messages"].as<JsonArray>()) {
         String text      = msg["text"]    | "";
         String sender    = msg["sender"]  | "";
@@ -92,15 +128,26 @@ void pullMessagesFromServer() {
         }
         uint8_t heartbeatPulses = msg["heartbeatPulses"] | 0;
 
+        // Keyframe effect: inline object is kept as JSON text, a string names an SD effect
+        String ledFx;
+        if (msg["ledFx"].is<JsonObject>()) {
+          serializeJson(msg["ledFx"], ledFx);
+        } else if (msg["ledFx"].is<const char*>()) {
+          ledFx = msg["ledFx"].as<const char*>();
+        }
+        if (ledFx.length() > LEDFX_DOC_SIZE) {
+          Serial.printf("[Pull] ledFx of %u bytes over %d, ignored\n", ledFx.length(), LEDFX_DOC_SIZE);
+          ledFx = "";
+        }
+
         // --- IMAGE MESSAGE HANDLING ---
         if (text.startsWith("[IMAGE]")) {
           String imgFile = text.substring(7);
           imgFile.trim();
           displayShowNotification("Incoming LoveByte!");
           delay(650);
-          ImageHandler::receive(imgFile, cfg.serverAddress);
-          g_displayLock = true;
-          messageShownAt = millis();
+          ImageHandler::receive(imgFile);
+          DisplayOwner::hold(messageLockDuration);
           continue;
         }
 
@@ -108,52 +155,32 @@ void pullMessagesFromServer() {
         displayShowNotification("Incoming LoveByte!");
         delay(650);
 
-        if (useLedColor || useHeartbeat) {
+        if (useLedColor || useHeartbeat || ledFx.length()) {
           MessageHandler::receive(
             text, sender, timeRecv,
-            ledColor, useLedColor, useHeartbeat, heartbeatColor, heartbeatPulses
+            ledColor, useLedColor, useHeartbeat, heartbeatColor, heartbeatPulses, ledFx
           );
         } else {
           MessageHandler::receive(text, sender, timeRecv);
         }
-        g_displayLock = true;
-        messageShownAt = millis();
+        DisplayOwner::hold(messageLockDuration);
       }
+    } else if (err) {
+      Serial.printf("[Pull] Reply not parsed: %s\n", err.c_str());
     }
-  }
-  http.end();
-}
-
-// --- LOGGED NTP SYNC (STATUS) ---
-bool syncNtpAndWaitLogged() {
-  int tz_sec = Config::get().timezone * 3600;
-  configTime(Config::get().timezone, 0, "pool.ntp.org");
-  struct tm timeinfo;
-  int retries = 0;
-  bool synced = false;
-  while (retries < 20) {
-    if (getLocalTime(&timeinfo) && timeinfo.tm_year >= 70) {
-      synced = true;
-      break;
-    }
-    delay(500);
-    retries++;
-  }
-  if (synced) {
-    char buf[32];
-    strftime(buf, sizeof(buf), "%Y-%m-%d %H:%M:%S", &timeinfo);
-    Config::get().lastNtpTime = String(buf);
-    Config::save();
-    return true;
   } else {
-    return false;
+    Metrics::inc(Metrics::Counter::PullErrors);
   }
+  http.end();
 }
 
 // --- TIMESTAMP HELPER ---
 String getCurrentTimeString() {
   struct tm timeinfo;
-  if (getLocalTime(&timeinfo) && timeinfo.tm_year >= 70) {
+  // Never waits: the clock is either restored/synced already or it isn't
+  if (TimeSync::valid()) {
+    time_t now = time(nullptr);
+    localtime_r(&now, &timeinfo);
     char buf[24] = {0};
     strftime(buf, sizeof(buf), "%Y-%m-%d %H:%M:%S", &timeinfo);
     return String(buf);
@@ -179,12 +206,11 @@ void showSplash() {
     File f = SD_MMC.open(splashPath.c_str());
     if (f) {
       size_t jpgLen = f.size();
-      uint8_t *jpgBuf = (uint8_t*)ps_malloc(jpgLen);
-      if (!jpgBuf) jpgBuf = (uint8_t*)malloc(jpgLen);
+      uint8_t *jpgBuf = (uint8_t*)PsramPool::alloc(jpgLen);
       if (jpgBuf && f.read(jpgBuf, jpgLen) == jpgLen) {
-        display.drawJpg(jpgBuf, jpgLen, 0, 0, display.width(), display.height());
+        ImageHandler::drawJpg(jpgBuf, jpgLen);
       }
-      free(jpgBuf);
+      PsramPool::free(jpgBuf);
       f.close();
     } else {
       display.fillScreen(BLACK);
@@ -196,7 +222,6 @@ void showSplash() {
     int y = (display.height() - 28) / 2;
     drawCenteredText("LoveByte", y, PINK);
   }
-  delay(3000);
 }
 
 void showApInfo() {
@@ -221,6 +246,7 @@ void showWelcomeScreen() {
 void setup() {
   Serial.begin(115200);
   delay(200);
+  BootProfile::mark("serial");
 
   Led::begin();
   Led::setMode(LedMode::BootBlink);
@@ -228,40 +254,65 @@ void setup() {
   display.init();
   display.setRotation(1);
   display.fillScreen(BLACK);
+  PsramPool::begin();
+  RenderPipe::begin();
 
   analogReadResolution(12);
+  BootProfile::mark("display");
+
+  // Start associating first; it runs in the background through the rest
+  Config::begin();
+  Endpoint::update();
+  TimeSync::begin(Config::get().timezone);
+  WiFiMgr::begin();
+  unsigned long wifiStart = millis();
+  BootProfile::mark("wifi_begin");
 
   SD_MMC.setPins(PIN_SD_CLK, PIN_SD_CMD, PIN_SD_D0, PIN_SD_D1, PIN_SD_D2, PIN_SD_D3);
   bool sd_ok = SD_MMC.begin("/sd", false);
-
-  WiFiMgr::begin();
-  Config::begin();
-  setupMessagePageRoutes(server);
-  setupFileManagerRoutes(server);
-  setupConfigPageRoutes(server);
-  setupDiagPageRoutes(server);
-  setupLandingPageRoutes(server);
+  if (sd_ok) {
+    SdStats::begin();
+    FileIndex::begin();
+    Thumbs::begin();
+  }
+  BootProfile::mark("sd");
 
   if (sd_ok) showSplash();
   else {
     display.fillScreen(BLACK);
     int y = (display.height() - 28) / 2;
     drawCenteredText("SD Not Found!", y, PINK);
-    delay(2000);
   }
+  unsigned long splashAt = millis();
+  BootProfile::mark("splash");
 
-  // Wait up to 7s for WiFi connection
-  unsigned long wifiStart = millis();
-  while (!WiFiMgr::isConnected() && millis() - wifiStart < 7000) {
+  Outbound::begin();
+  setupMessagePageRoutes(server);
+  setupFileManagerRoutes(server);
+  if (sd_ok) setupUploadRoutes(server);
+  setupConfigPageRoutes(server);
+  setupDiagPageRoutes(server);
+  Telemetry::begin(server);
+  setupLandingPageRoutes(server);
+  BootProfile::mark("routes");
+
+  // The splash stays up for BOOT_SPLASH_MS while Wi-Fi finishes (up to
+  // BOOT_WIFI_WAIT_MS from its start) and the file index builds
+  while (millis() - splashAt < BOOT_SPLASH_MS ||
+         (!WiFiMgr::isConnected() && millis() - wifiStart < BOOT_WIFI_WAIT_MS)) {
     WiFiMgr::loop();
     Led::loop();
+    FileIndex::loop();
     delay(8);
   }
+  BootProfile::mark("wait");
 
   if (WiFiMgr::isConnected()) {
+    BootProfile::span("wifi_connect", WiFiMgr::connectMs());
     Led::setMode(LedMode::RainbowFade);
-    syncNtpAndWaitLogged();
+    TimeSync::start();
     checkInWithServer(); // Device check-in to server
+    BootProfile::mark("checkin");
     showWelcomeScreen();
 
     if (MDNS.begin("lovebyte")) {
@@ -272,6 +323,7 @@ void setup() {
     Led::setMode(LedMode::BreathePink);
     showApInfo();
   }
+  BootProfile::mark("ready");
 }
 
 void loop() {
@@ -279,20 +331,31 @@ void loop() {
   static bool bootDone = false;
   static unsigned long lastPull = 0;
 
+  Metrics::loopTick();
   WiFiMgr::loop();
+  Telemetry::loop();
+
+  // Run display/SD work queued by web handlers
+  DisplayOwner::service();
 
-  // --- PATCH: Unlock message lock after display duration ---
-  if (g_displayLock) {
+  // Keep the file manager index fresh, a few entries per pass
+  FileIndex::loop();
+  Thumbs::loop();
+  SdStats::loop();
+  TimeSync::loop();
+  Config::loop();
+  SdBench::loop();
+
+  // Keep a freshly shown message up until its hold expires
+  if (DisplayOwner::isHeld()) {
     Led::loop();
-    if (millis() - messageShownAt > messageLockDuration) {
-      clearDisplayedMessage();
-    }
     return;
   }
 
   bool nowConnected = WiFiMgr::isConnected();
   if (bootDone && nowConnected != lastConnected) {
     if (nowConnected) {
+      Metrics::inc(Metrics::Counter::WifiReconnects);
       Led::setMode(LedMode::RainbowFade);
       showWelcomeScreen();
     } else {
@@ -316,9 +379,13 @@ void loop() {
     }
   }
 
-  // --- PATCH: Pull messages every 10 seconds ---
-  if (nowConnected && millis() - lastPull > 10000) {
+  // Start NTP on the first connection if Wi-Fi wasn't up by the end of setup()
+  if (nowConnected) TimeSync::start();
+
+  // --- PATCH: Pull messages every 10 seconds (first one right away) ---
+  if (nowConnected && (!lastPull || millis() - lastPull > 10000)) {
     pullMessagesFromServer();
+    if (!lastPull) BootProfile::mark("first_pull");
     lastPull = millis();
   }
 
@@ -391,13 +458,7 @@ void displayShowMessage(const String& txt) {
     display.print(datetime);
   }
 
-  g_displayLock = true;
-  messageShownAt = millis(); // Start lock timer
-}
-
-// Always clear lock after display duration
-void clearDisplayedMessage() {
-  g_displayLock = false;
+  DisplayOwner::hold(messageLockDuration); // Start lock timer
 }
 
 // When you want to generate a message (direct user message, not from server pull)
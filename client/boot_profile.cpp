@@ -0,0 +1,50 @@
+#include "boot_profile.h"
+#include <atomic>
+#include <esp_timer.h>
+
+struct Phase {
+    const char* name;   // string literal
+    uint32_t at;        // ms since power-up
+    uint32_t ms;
+};
+
+static Phase phases[BOOT_PROFILE_MAX];
+static std::atomic<uint8_t> count{0};
+static uint32_t lastAt = 0;
+
+static uint32_t nowMs() {
+    return (uint32_t)(esp_timer_get_time() / 1000);
+}
+
+// Loop task only; readers see an entry once count covers it
+static void record(const char* phase, uint32_t at, uint32_t ms) {
+    uint8_t n = count.load(std::memory_order_relaxed);
+    if (n >= BOOT_PROFILE_MAX) return;
+    phases[n] = { phase, at, ms };
+    count.store(n + 1, std::memory_order_release);
+    Serial.printf("[Boot] %-12s at %5lu ms  (%lu ms)\n", phase, (unsigned long)at, (unsigned long)ms);
+}
+
+void BootProfile::mark(const char* phase) {
+    uint32_t at = nowMs();
+    record(phase, at, at - lastAt);
+    lastAt = at;
+}
+
+void BootProfile::span(const char* phase, uint32_t ms) {
+    record(phase, nowMs(), ms);
+}
+
+void BootProfile::write(Print& out) {
+    uint8_t n = count.load(std::memory_order_acquire);
+    out.printf("# HELP lovebyte_boot_phase_at_ms Time since power-up when a boot phase ended\n"
+               "# TYPE lovebyte_boot_phase_at_ms gauge\n");
+    for (uint8_t i = 0; i < n; ++i) {
+        out.printf("lovebyte_boot_phase_at_ms{phase=\"%s\"} %u\n", phases[i].name, (unsigned)phases[i].at);
+    }
+    out.printf("# HELP lovebyte_boot_phase_ms Duration of a boot phase\n"
+               "# TYPE lovebyte_boot_phase_ms gauge\n");
+    for (uint8_t i = 0; i < n; ++i) {
+        out.printf("lovebyte_boot_phase_ms{phase=\"%s\"} %u\n", phases[i].name, (unsigned)phases[i].ms);
+    }
+}
@@ -0,0 +1,21 @@
+// boot_profile.h
+#pragma once
+
+#include <Arduino.h>
+
+// Timestamps for the phases of a boot, logged as they happen and kept for
+// /metrics. Phases that finish after setup() (NTP, first pull) are marked
+// from loop() the same way.
+
+#define BOOT_PROFILE_MAX  16
+
+namespace BootProfile {
+    // A phase ended now; its duration runs from the previous mark
+    void mark(const char* phase);
+
+    // A phase with its own duration (e.g. a Wi-Fi association that ran
+    // in the background alongside others)
+    void span(const char* phase, uint32_t ms);
+
+    void write(Print& out);     // Prometheus gauges
+}
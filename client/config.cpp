@@ -1,41 +1,210 @@
 #include "config.h"
+#include "metrics.h"
 #include <Preferences.h>
 static DeviceConfig cfg;
+static DeviceConfig committed;      // what flash holds
 static Preferences prefs;
 
+static portMUX_TYPE mux = portMUX_INITIALIZER_UNLOCKED;
+static SemaphoreHandle_t fieldLock = nullptr;   // cfg's Strings, across tasks
+static bool pending = false;
+static unsigned long pendingAt = 0;
+
+#define BLOB_MAX  512
+
+// --- Blob: [version][field count] then fields in v1 order, strings as
+// [len][bytes]. Later versions only append, so an older blob decodes into
+// the leading fields and the rest keep their defaults.
+
+struct Writer {
+    uint8_t* buf; size_t len, cap;
+    void bytes(const void* p, size_t n) {
+        if (len + n <= cap) memcpy(buf + len, p, n);
+        len += n;
+    }
+    void str(const String& s) {
+        uint8_t n = s.length() > 255 ? 255 : s.length();
+        bytes(&n, 1);
+        bytes(s.c_str(), n);
+    }
+};
+
+struct Reader {
+    const uint8_t* buf; size_t len, pos;
+    bool bytes(void* p, size_t n) {
+        if (pos + n > len) return false;
+        memcpy(p, buf + pos, n);
+        pos += n;
+        return true;
+    }
+    bool str(String& s) {
+        uint8_t n;
+        if (!bytes(&n, 1) || pos + n > len) return false;
+        s = "";
+        s.reserve(n);
+        for (uint8_t i = 0; i < n; ++i) s += (char)buf[pos + i];
+        pos += n;
+        return true;
+    }
+};
+
+#define BLOB_FIELDS 8
+
+static size_t encode(const DeviceConfig& c, uint8_t* buf, size_t cap) {
+    Writer w = { buf, 0, cap };
+    uint8_t hdr[2] = { CONFIG_VERSION, BLOB_FIELDS };
+    w.bytes(hdr, 2);
+    w.str(c.deviceName);
+    int32_t tz = c.timezone;
+    w.bytes(&tz, 4);
+    w.bytes(&c.lat, 4);
+    w.bytes(&c.lon, 4);
+    w.str(c.weatherApiKey);
+    w.str(c.weatherPostal);
+    w.str(c.weatherCountry);
+    w.str(c.serverAddress);
+    return w.len <= cap ? w.len : 0;
+}
+
+static bool decode(DeviceConfig& c, const uint8_t* buf, size_t len) {
+    Reader r = { buf, len, 0 };
+    uint8_t hdr[2];
+    if (!r.bytes(hdr, 2) || hdr[0] == 0 || hdr[0] > CONFIG_VERSION) return false;
+    uint8_t n = hdr[1];
+    int32_t tz = c.timezone;
+    bool ok = (n < 1 || r.str(c.deviceName)) &&
+              (n < 2 || r.bytes(&tz, 4)) &&
+              (n < 3 || r.bytes(&c.lat, 4)) &&
+              (n < 4 || r.bytes(&c.lon, 4)) &&
+              (n < 5 || r.str(c.weatherApiKey)) &&
+              (n < 6 || r.str(c.weatherPostal)) &&
+              (n < 7 || r.str(c.weatherCountry)) &&
+              (n < 8 || r.str(c.serverAddress));
+    c.timezone = tz;
+    return ok;
+}
+
+static bool settingsDiffer(const DeviceConfig& a, const DeviceConfig& b) {
+    return a.deviceName != b.deviceName || a.timezone != b.timezone ||
+           a.lat != b.lat || a.lon != b.lon ||
+           a.weatherApiKey != b.weatherApiKey || a.weatherPostal != b.weatherPostal ||
+           a.weatherCountry != b.weatherCountry || a.serverAddress != b.serverAddress;
+}
+
+static void defaults(DeviceConfig& c) {
+    c.deviceName = "LoveByte";
+    c.timezone = 0;
+    c.lat = c.lon = 0.0;
+    c.weatherApiKey = c.weatherPostal = c.weatherCountry = c.serverAddress = "";
+    c.lastNtpTime = "";
+}
+
+// Pre-blob firmware kept one key per field
+static const char* const LEGACY_KEYS[] = {
+    "devname", "tz", "lat", "lon", "weatherKey", "postal", "country", "server"
+};
+
+static bool loadLegacy(DeviceConfig& c) {
+    if (!prefs.isKey("devname") && !prefs.isKey("server") && !prefs.isKey("tz")) return false;
+    c.deviceName     = prefs.getString("devname", "LoveByte");
+    c.timezone       = prefs.getInt("tz", 0);
+    c.lat            = prefs.getFloat("lat", 0.0);
+    c.lon            = prefs.getFloat("lon", 0.0);
+    c.weatherApiKey  = prefs.getString("weatherKey", "");
+    c.weatherPostal  = prefs.getString("postal", "");
+    c.weatherCountry = prefs.getString("country", "");
+    c.serverAddress  = prefs.getString("server", "");
+    return true;
+}
+
+static bool writeBlob(const DeviceConfig& c) {
+    uint8_t buf[BLOB_MAX];
+    size_t len = encode(c, buf, sizeof(buf));
+    if (!len) {
+        Serial.println("[Config] Settings too large for the blob");
+        return false;
+    }
+    bool ok = prefs.putBytes("cfg", buf, len) == len;
+    Metrics::inc(Metrics::Counter::ConfigWrites);
+    return ok;
+}
+
 void Config::begin() { load(); }
 
 void Config::load() {
-    prefs.begin("devcfg", true);
-    cfg.deviceName     = prefs.getString("devname", "LoveByte");
-    cfg.timezone       = prefs.getInt("tz", 0);
-    cfg.lat            = prefs.getFloat("lat", 0.0);
-    cfg.lon            = prefs.getFloat("lon", 0.0);
-    cfg.weatherApiKey  = prefs.getString("weatherKey", "");
-    cfg.weatherPostal  = prefs.getString("postal", "");
-    cfg.weatherCountry = prefs.getString("country", "");
-    cfg.serverAddress  = prefs.getString("server", "");      // <-- added
-    cfg.lastNtpTime    = prefs.getString("ntp", "");
+    if (!fieldLock) fieldLock = xSemaphoreCreateMutex();
+    defaults(cfg);
+    prefs.begin("devcfg", false);
+    uint8_t buf[BLOB_MAX];
+    size_t len = prefs.isKey("cfg") ? prefs.getBytes("cfg", buf, sizeof(buf)) : 0;
+    bool migrate = false;
+    if (len && decode(cfg, buf, len)) {
+        migrate = buf[0] < CONFIG_VERSION;
+    } else if (loadLegacy(cfg)) {
+        Serial.println("[Config] Migrating per-key settings to the blob");
+        migrate = true;
+    }
+    cfg.lastNtpTime = prefs.getString("ntp", "");
+    if (migrate && writeBlob(cfg)) {
+        for (const char* k : LEGACY_KEYS) prefs.remove(k);
+    }
     prefs.end();
+    committed = cfg;
 }
 
 void Config::save() {
+    portENTER_CRITICAL(&mux);
+    pending = true;
+    pendingAt = millis();
+    portEXIT_CRITICAL(&mux);
+}
+
+void Config::loop() {
+    portENTER_CRITICAL(&mux);
+    bool due = pending && millis() - pendingAt >= CONFIG_COMMIT_DELAY_MS;
+    portEXIT_CRITICAL(&mux);
+    if (due) commit();
+}
+
+void Config::commit() {
+    portENTER_CRITICAL(&mux);
+    pending = false;
+    portEXIT_CRITICAL(&mux);
+
+    lock();
+    DeviceConfig now = cfg;
+    unlock();
+    bool settings = settingsDiffer(now, committed);
+    bool ntp = now.lastNtpTime != committed.lastNtpTime;
+    if (!settings && !ntp) return;
+
     prefs.begin("devcfg", false);
-    prefs.putString("devname",    cfg.deviceName);
-    prefs.putInt("tz",            cfg.timezone);
-    prefs.putFloat("lat",         cfg.lat);
-    prefs.putFloat("lon",         cfg.lon);
-    prefs.putString("weatherKey", cfg.weatherApiKey);
-    prefs.putString("postal",     cfg.weatherPostal);
-    prefs.putString("country",    cfg.weatherCountry);
-    prefs.putString("server",     cfg.serverAddress);        // <-- added
-    prefs.putString("ntp",        cfg.lastNtpTime);
+    if (settings && writeBlob(now)) {
+        committed.deviceName = now.deviceName;
+        committed.timezone = now.timezone;
+        committed.lat = now.lat;
+        committed.lon = now.lon;
+        committed.weatherApiKey = now.weatherApiKey;
+        committed.weatherPostal = now.weatherPostal;
+        committed.weatherCountry = now.weatherCountry;
+        committed.serverAddress = now.serverAddress;
+    }
+    if (ntp) {
+        prefs.putString("ntp", now.lastNtpTime);
+        Metrics::inc(Metrics::Counter::ConfigWrites);
+        committed.lastNtpTime = now.lastNtpTime;
+    }
     prefs.end();
 }
 
 DeviceConfig& Config::get() { return cfg; }
 
+void Config::lock() { xSemaphoreTake(fieldLock, portMAX_DELAY); }
+void Config::unlock() { xSemaphoreGive(fieldLock); }
+
 void Config::setNtpTime(const String& iso8601) {
+    lock();
     cfg.lastNtpTime = iso8601;
+    unlock();
     save();
 }
@@ -1,6 +1,15 @@
 #pragma once
 #include <Arduino.h>
 
+// Settings live in one versioned blob ("cfg") in the "devcfg" namespace;
+// the NTP stamp, which changes on every sync, has its own key so it never
+// drags the rest along. save() only schedules a commit: loop() writes what
+// actually differs from the last committed copy, CONFIG_COMMIT_DELAY_MS
+// after the latest save(), so bursts of saves cost one flash write.
+
+#define CONFIG_VERSION          1
+#define CONFIG_COMMIT_DELAY_MS  1000
+
 struct DeviceConfig {
     String deviceName;
     int timezone;
@@ -15,8 +24,14 @@ struct DeviceConfig {
 
 namespace Config {
     void begin();
-    void save();
+    void loop();        // call from loop(): commits a pending save once due
+    void save();        // schedule a commit (any task)
+    void commit();      // write pending changes now (e.g. before a restart)
     void load();
     DeviceConfig& get();
+    // Hold around changing fields from a web handler, or reading the String
+    // fields from outside loop(); commit() copies the config under it
+    void lock();
+    void unlock();
     void setNtpTime(const String& iso8601);
 }
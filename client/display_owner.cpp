@@ -0,0 +1,74 @@
+#include "display_owner.h"
+#include "spsc.h"
+#include "message.h"
+#include "image.h"
+#include "file_index.h"
+#include "thumbs.h"
+#include "sd_stats.h"
+#include "led.h"
+#include <SD_MMC.h>
+
+struct OwnerCmd {
+    DisplayOwner::Cmd cmd;
+    char a[256];
+    char b[40];
+    char c[32];
+};
+
+static SpscRing<OwnerCmd, 8> queue;
+
+static bool held = false;
+static unsigned long heldAt = 0;
+static unsigned long heldFor = 0;
+
+bool DisplayOwner::post(Cmd cmd, const char* a, const char* b, const char* c) {
+    OwnerCmd* s = queue.producerSlot();
+    if (!s) return false;
+    s->cmd = cmd;
+    strlcpy(s->a, a ? a : "", sizeof(s->a));
+    strlcpy(s->b, b ? b : "", sizeof(s->b));
+    strlcpy(s->c, c ? c : "", sizeof(s->c));
+    queue.publish();
+    return true;
+}
+
+void DisplayOwner::hold(unsigned long ms) {
+    held = true;
+    heldAt = millis();
+    heldFor = ms;
+}
+
+bool DisplayOwner::isHeld() {
+    if (held && millis() - heldAt > heldFor) held = false;
+    return held;
+}
+
+void DisplayOwner::service() {
+    OwnerCmd* s;
+    while ((s = queue.consumerSlot())) {
+        switch (s->cmd) {
+            case Cmd::ShowMessage:
+                if (isHeld()) return;   // keep order; retry next loop
+                MessageHandler::receive(s->a, s->b, s->c);
+                break;
+            case Cmd::ShowImage:
+                if (isHeld()) return;
+                ImageHandler::display(s->a);
+                break;
+            case Cmd::RemoveFile:
+                if (!SdStats::remove(s->a)) {
+                    Serial.printf("[Owner] Remove failed: %s\n", s->a);
+                } else {
+                    String path = s->a;
+                    int slash = path.lastIndexOf('/');
+                    FileIndex::invalidate(path.substring(0, slash).c_str());
+                    if (path.startsWith("/images/")) Thumbs::invalidate(path.substring(slash + 1));
+                }
+                break;
+            case Cmd::PlayLedFx:
+                if (!Led::playEffect(s->a)) Serial.printf("[Owner] LED effect not found: %s\n", s->a);
+                break;
+        }
+        queue.release();
+    }
+}
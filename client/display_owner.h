@@ -0,0 +1,27 @@
+// display_owner.h
+#pragma once
+
+#include <Arduino.h>
+
+// The main loop is the only context that draws to the display or writes to
+// the SD card. Other contexts (AsyncTCP web handlers) post commands here;
+// posting copies into a fixed slot of a lock-free SPSC ring and never blocks.
+
+namespace DisplayOwner {
+    enum class Cmd : uint8_t {
+        ShowMessage,    // a = text, b = sender, c = time
+        ShowImage,      // a = filename in /images
+        RemoveFile,     // a = full SD path
+        PlayLedFx       // a = effect name in LEDFX_DIR
+    };
+
+    // Producer: the AsyncTCP task. Returns false if the queue is full.
+    bool post(Cmd cmd, const char* a, const char* b = "", const char* c = "");
+
+    // Consumer: call from loop(). Display commands wait while the screen is held.
+    void service();
+
+    // Keep the current screen (message/image) up for ms before loop() redraws
+    void hold(unsigned long ms);
+    bool isHeld();
+}
@@ -0,0 +1,84 @@
+#include "endpoint.h"
+#include "config.h"
+
+// update() parses into a local and swaps it in under the lock; readers take
+// a copy under the same lock, so one holding it across a slow HTTP call is
+// unaffected by any number of config saves meanwhile.
+static Endpoint::Server current;
+static portMUX_TYPE mux = portMUX_INITIALIZER_UNLOCKED;
+
+static bool parse(const char* addr, Endpoint::Server& s) {
+    while (*addr == ' ') ++addr;
+    s.https = false;
+    if (!strncasecmp(addr, "http://", 7)) addr += 7;
+    else if (!strncasecmp(addr, "https://", 8)) { addr += 8; s.https = true; }
+
+    // host[:port], up to any path
+    size_t hostLen = strcspn(addr, ":/ ");
+    if (!hostLen || hostLen >= sizeof(s.host)) return false;
+    memcpy(s.host, addr, hostLen);
+    s.host[hostLen] = 0;
+
+    s.port = SERVER_DEFAULT_PORT;
+    if (addr[hostLen] == ':') {
+        char* end;
+        long port = strtol(addr + hostLen + 1, &end, 10);
+        if (port <= 0 || port > 65535 || (*end && *end != '/' && *end != ' ')) return false;
+        s.port = port;
+    }
+    int n = snprintf(s.base, sizeof(s.base), "%s://%s:%u", s.https ? "https" : "http", s.host, s.port);
+    return n > 0 && n < (int)sizeof(s.base);
+}
+
+static bool jsonBody(const String& name, Endpoint::Server& s) {
+    size_t n = strlcpy(s.deviceBody, "{\"device_id\":\"", sizeof(s.deviceBody));
+    for (const char* c = name.c_str(); *c; ++c) {
+        if (n + 4 >= sizeof(s.deviceBody)) return false;
+        if (*c == '"' || *c == '\\') s.deviceBody[n++] = '\\';
+        if ((uint8_t)*c >= 0x20) s.deviceBody[n++] = *c;
+    }
+    s.deviceBody[n++] = '"';
+    s.deviceBody[n++] = '}';
+    s.deviceBody[n] = 0;
+    s.deviceBodyLen = n;
+    return true;
+}
+
+void Endpoint::update() {
+    DeviceConfig& cfg = Config::get();
+    Server s;
+    memset(&s, 0, sizeof(s));
+    Config::lock();
+    bool ok = cfg.serverAddress.length() && cfg.deviceName.length() &&
+              parse(cfg.serverAddress.c_str(), s) && jsonBody(cfg.deviceName, s);
+    if (ok) {
+        ok = snprintf(s.pullUrl, sizeof(s.pullUrl), "%s/api/pull", s.base) < (int)sizeof(s.pullUrl) &&
+             snprintf(s.checkinUrl, sizeof(s.checkinUrl), "%s/api/checkin", s.base) < (int)sizeof(s.checkinUrl);
+    }
+    if (!ok && cfg.serverAddress.length()) {
+        Serial.printf("[Endpoint] Can't use server address \"%s\"\n", cfg.serverAddress.c_str());
+    }
+    Config::unlock();
+    s.valid = ok;
+
+    portENTER_CRITICAL(&mux);
+    current = s;
+    portEXIT_CRITICAL(&mux);
+}
+
+Endpoint::Server Endpoint::get() {
+    portENTER_CRITICAL(&mux);
+    Server s = current;
+    portEXIT_CRITICAL(&mux);
+    return s;
+}
+
+bool Endpoint::url(char* out, size_t cap, const char* path) {
+    char base[ENDPOINT_URL_MAX];
+    portENTER_CRITICAL(&mux);
+    memcpy(base, current.base, sizeof(base));
+    portEXIT_CRITICAL(&mux);
+    if (!base[0]) return false;
+    int n = snprintf(out, cap, "%s%s", base, path);
+    return n > 0 && (size_t)n < cap;
+}
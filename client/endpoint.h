@@ -0,0 +1,39 @@
+// endpoint.h
+#pragma once
+
+#include <Arduino.h>
+
+// The LoveByte server as configured, parsed once per config change instead
+// of on every request. The configured address may carry a scheme, a port
+// and a trailing slash ("http://10.0.0.5:6969/"); a bare host gets
+// SERVER_DEFAULT_PORT. The URLs and JSON body the polling loop sends are
+// preformatted here so the hot path builds no Strings.
+
+#define SERVER_DEFAULT_PORT   6969
+#define ENDPOINT_HOST_MAX     64
+#define ENDPOINT_URL_MAX      128
+#define ENDPOINT_BODY_MAX     96
+
+namespace Endpoint {
+    struct Server {
+        bool valid;                         // address and device name both set
+        bool https;
+        uint16_t port;
+        char host[ENDPOINT_HOST_MAX];
+        char base[ENDPOINT_URL_MAX];        // "http://host:port", no trailing slash
+        char pullUrl[ENDPOINT_URL_MAX];
+        char checkinUrl[ENDPOINT_URL_MAX];
+        char deviceBody[ENDPOINT_BODY_MAX]; // {"device_id":"<name>"}
+        uint16_t deviceBodyLen;
+    };
+
+    // Re-parse from Config; call after the server address or device name
+    // changes. Safe from any task.
+    void update();
+
+    // A copy of the current server, which later updates leave alone
+    Server get();
+
+    // base + path into out; false if there is no server or it won't fit
+    bool url(char* out, size_t cap, const char* path);
+}
@@ -0,0 +1,223 @@
+#include "file_index.h"
+#include <SD_MMC.h>
+#include <esp_heap_caps.h>
+#include <algorithm>
+
+struct IndexEntry {
+    uint32_t name;                  // offset of the NUL-terminated name in Snapshot::names
+    uint32_t size;
+    uint32_t mtime;
+};
+
+struct Snapshot {
+    IndexEntry* entries = nullptr;
+    uint32_t* bySize = nullptr;     // permutations of entries (which are name-sorted)
+    uint32_t* byTime = nullptr;
+    char* names = nullptr;
+    uint32_t count = 0;
+    uint32_t namesLen = 0;
+    uint32_t skipped = 0;           // files left out when a buffer couldn't grow
+
+    void release() {
+        free(entries); free(bySize); free(byTime); free(names);
+        entries = nullptr; bySize = byTime = nullptr; names = nullptr;
+        count = namesLen = skipped = 0;
+    }
+};
+
+struct DirIndex {
+    const char* path;
+    const char* key;
+    Snapshot live;                  // guarded by lock
+    bool ready = false;             // live has been built at least once
+    volatile uint32_t generation = 1;   // bumped by invalidate()
+    uint32_t builtGeneration = 0;
+
+    // Builder state (loop() only)
+    bool building = false;
+    uint32_t buildingGeneration = 0;
+    File dir;
+    Snapshot next;
+    uint32_t cap = 0;
+    uint32_t namesCap = 0;
+};
+
+static DirIndex dirs[] = {
+    { "/images",   "images" },
+    { "/messages", "messages" },
+};
+static const size_t DIR_COUNT = sizeof(dirs) / sizeof(dirs[0]);
+
+static SemaphoreHandle_t lock = nullptr;
+
+// PSRAM first, internal RAM if there is none
+static void* growBuf(void* p, size_t bytes) {
+    void* n = heap_caps_realloc(p, bytes, MALLOC_CAP_SPIRAM);
+    return n ? n : realloc(p, bytes);
+}
+
+static DirIndex* findDir(const char* dir) {
+    for (size_t i = 0; i < DIR_COUNT; ++i) {
+        if (!strcmp(dir, dirs[i].path) || !strcmp(dir, dirs[i].key)) return &dirs[i];
+    }
+    return nullptr;
+}
+
+void FileIndex::begin() {
+    if (!lock) lock = xSemaphoreCreateMutex();
+    for (size_t i = 0; i < DIR_COUNT; ++i) dirs[i].generation++;
+}
+
+void FileIndex::invalidate(const char* dir) {
+    DirIndex* d = findDir(dir);
+    if (d) d->generation++;
+}
+
+// -- Builder --
+static void startBuild(DirIndex& d) {
+    d.buildingGeneration = d.generation;
+    d.next.count = d.next.namesLen = d.next.skipped = 0;
+    d.dir = SD_MMC.open(d.path);
+    d.building = true;
+}
+
+static void finishBuild(DirIndex& d) {
+    if (d.dir) d.dir.close();
+    Snapshot& n = d.next;
+    IndexEntry* e = n.entries;
+    const char* names = n.names;
+    uint32_t count = n.count;
+
+    if (count) {
+        std::sort(e, e + count, [names](const IndexEntry& a, const IndexEntry& b) {
+            return strcmp(names + a.name, names + b.name) < 0;
+        });
+        n.bySize = (uint32_t*)growBuf(nullptr, count * sizeof(uint32_t));
+        n.byTime = (uint32_t*)growBuf(nullptr, count * sizeof(uint32_t));
+        if (n.bySize && n.byTime) {
+            for (uint32_t i = 0; i < count; ++i) n.bySize[i] = n.byTime[i] = i;
+            std::stable_sort(n.bySize, n.bySize + count, [e](uint32_t a, uint32_t b) { return e[a].size < e[b].size; });
+            std::stable_sort(n.byTime, n.byTime + count, [e](uint32_t a, uint32_t b) { return e[a].mtime < e[b].mtime; });
+        }
+    }
+
+    Snapshot old;
+    xSemaphoreTake(lock, portMAX_DELAY);
+    old = d.live;
+    d.live = n;
+    d.ready = true;
+    d.builtGeneration = d.buildingGeneration;
+    xSemaphoreGive(lock);
+    old.release();
+
+    d.next = Snapshot();
+    d.cap = d.namesCap = 0;
+    d.building = false;
+    if (n.skipped) Serial.printf("[FileIndex] %s: %u entries, %u skipped (out of memory)\n",
+                                 d.path, (unsigned)count, (unsigned)n.skipped);
+    else Serial.printf("[FileIndex] %s: %u entries\n", d.path, (unsigned)count);
+}
+
+static void stepBuild(DirIndex& d) {
+    if (!d.dir) { finishBuild(d); return; }
+    for (int i = 0; i < FILE_INDEX_STEP; ++i) {
+        File f = d.dir.openNextFile();
+        if (!f) { finishBuild(d); return; }
+        if (f.isDirectory()) { f.close(); continue; }
+
+        const char* name = f.name();
+        const char* slash = strrchr(name, '/');
+        if (slash) name = slash + 1;
+        uint32_t len = strlen(name) + 1;
+
+        // Out of memory the walk goes on, counting what it leaves out
+        if (d.next.count == d.cap) {
+            uint32_t cap = d.cap ? d.cap * 2 : 256;
+            IndexEntry* grown = (IndexEntry*)growBuf(d.next.entries, cap * sizeof(IndexEntry));
+            if (!grown) { d.next.skipped++; f.close(); continue; }
+            d.next.entries = grown;
+            d.cap = cap;
+        }
+        if (d.next.namesLen + len > d.namesCap) {
+            uint32_t cap = std::max(d.namesCap ? d.namesCap * 2 : 4096, d.next.namesLen + len);
+            char* grown = (char*)growBuf(d.next.names, cap);
+            if (!grown) { d.next.skipped++; f.close(); continue; }
+            d.next.names = grown;
+            d.namesCap = cap;
+        }
+        IndexEntry& e = d.next.entries[d.next.count++];
+        e.name = d.next.namesLen;
+        memcpy(d.next.names + e.name, name, len);
+        d.next.namesLen += len;
+        e.size = f.size();
+        e.mtime = (uint32_t)f.getLastWrite();
+        f.close();
+    }
+}
+
+void FileIndex::loop() {
+    if (!lock) return;
+    for (size_t i = 0; i < DIR_COUNT; ++i) {
+        DirIndex& d = dirs[i];
+        if (!d.building && d.builtGeneration != d.generation) startBuild(d);
+        if (d.building) {
+            stepBuild(d);
+            return;     // one directory step per loop() pass
+        }
+    }
+}
+
+// -- Query --
+static bool matches(const char* name, const String& filter) {
+    if (!filter.length()) return true;
+    size_t n = filter.length();
+    for (const char* p = name; *p; ++p) {
+        if (!strncasecmp(p, filter.c_str(), n)) return true;
+    }
+    return false;
+}
+
+static void printJsonString(Print& out, const char* s) {
+    out.print('"');
+    for (; *s; ++s) {
+        char c = *s;
+        if (c == '"' || c == '\\') { out.print('\\'); out.print(c); }
+        else if ((uint8_t)c < 0x20) out.printf("\\u%04x", c);
+        else out.print(c);
+    }
+    out.print('"');
+}
+
+bool FileIndex::writePage(Print& out, const String& dir, uint32_t offset, uint32_t limit,
+                          Sort sort, bool desc, const String& filter) {
+    DirIndex* d = findDir(dir.c_str());
+    if (!d || !lock) return false;
+
+    xSemaphoreTake(lock, portMAX_DELAY);
+    if (!d->ready) {
+        xSemaphoreGive(lock);
+        return false;
+    }
+    const Snapshot& s = d->live;
+    const uint32_t* perm = sort == Sort::Size ? s.bySize : sort == Sort::Time ? s.byTime : nullptr;
+
+    out.printf("{\"dir\":\"%s\",\"total\":%u,\"skipped\":%u,\"offset\":%u,\"stale\":%s,\"items\":[",
+        d->key, (unsigned)s.count, (unsigned)s.skipped, (unsigned)offset,
+        d->builtGeneration != d->generation ? "true" : "false");
+
+    uint32_t matched = 0, emitted = 0;
+    for (uint32_t i = 0; i < s.count; ++i) {
+        uint32_t k = desc ? s.count - 1 - i : i;
+        const IndexEntry& e = s.entries[perm ? perm[k] : k];
+        const char* name = s.names + e.name;
+        if (!matches(name, filter)) continue;
+        if (matched++ < offset || emitted >= limit) continue;
+        if (emitted++) out.print(',');
+        out.print('[');
+        printJsonString(out, name);
+        out.printf(",%u,%u]", (unsigned)e.size, (unsigned)e.mtime);
+    }
+    out.printf("],\"matched\":%u}", (unsigned)matched);
+    xSemaphoreGive(lock);
+    return true;
+}
@@ -0,0 +1,31 @@
+// file_index.h
+#pragma once
+
+#include <Arduino.h>
+
+// Cached, sorted index of /images and /messages for the file manager API.
+// The index is (re)built a few entries at a time from loop(), into fresh
+// PSRAM buffers that are swapped in when complete, so readers always see a
+// consistent snapshot and a 10k-entry card never stalls a request. Names
+// of any length go into a pool next to the fixed-size entries.
+
+#define FILE_INDEX_STEP       48    // directory entries read per loop() call
+
+namespace FileIndex {
+    enum class Sort : uint8_t { Name, Size, Time };
+
+    void begin();   // start building every directory
+    void loop();    // call from loop(): advances any pending rebuild
+
+    // Mark a directory ("/images" or "/messages") stale after a write or
+    // delete. The old snapshot keeps serving until the rebuild completes.
+    void invalidate(const char* dir);
+
+    // Write one page as compact JSON:
+    // {"dir":"images","total":N,"skipped":S,"offset":O,"stale":false,
+    //  "items":[["name",size,mtime],...],"matched":M}
+    // skipped counts files left out because memory ran out mid-build.
+    // Returns false if the directory has never been indexed yet.
+    bool writePage(Print& out, const String& dir, uint32_t offset, uint32_t limit,
+                   Sort sort, bool desc, const String& filter);
+}
@@ -1,7 +1,17 @@
 #include "image.h"
 #include "settings.h"
+#include "render_pipe.h"
+#include "image_scale.h"
+#include "file_index.h"
+#include "thumbs.h"
+#include "metrics.h"
+#include "sd_stats.h"
+#include "endpoint.h"
+#include "sd_writer.h"
+#include "psram_pool.h"
 #include <SD_MMC.h>
 #include <AnimatedGIF.h>
+#include <JPEGDEC.h>
 #include <HTTPClient.h>
 #include <WiFiClient.h>
 
@@ -18,6 +28,9 @@ static size_t gifSize = 0;
 static AnimatedGIF gif;
 static bool gifNeedsInit = false;
 
+// --- Private: JPEG decoder (tiles go to the render pipeline) ---
+static JPEGDEC jpeg;
+
 struct RAMGIFHandle { uint8_t *data; size_t size; size_t pos; };
 void *GIFOpenRAM(const char *, int32_t *pSize) {
     RAMGIFHandle *h = new RAMGIFHandle{gifBuffer, gifSize, 0};
@@ -47,21 +60,36 @@ int32_t GIFSeekRAM(GIFFILE *pFile, int32_t iPosition) {
 }
 void GIFDraw(GIFDRAW *pDraw) {
     if (!pDraw->pPixels || !pDraw->pPalette) return;
+    if (ImageScale::gifScaling()) {
+        ImageScale::gifLine(pDraw);
+        return;
+    }
     int16_t y = pDraw->iY + pDraw->y;
     if (y < 0 || y >= ::display.height() || pDraw->iX >= ::display.width() || pDraw->iWidth < 1) return;
     int x_offset = (::display.width() - pDraw->iWidth) / 2;
     int y_offset = (::display.height() - pDraw->iHeight) / 2;
-    static uint16_t lineBuffer[480];
-    for (int x = 0; x < pDraw->iWidth; x++) {
-        lineBuffer[x] = pDraw->pPalette[pDraw->pPixels[x]];
+    int w = pDraw->iWidth < RENDER_TILE_PX ? pDraw->iWidth : RENDER_TILE_PX;
+    // Palette lookup straight into a pipeline tile; the other core pushes it
+    uint16_t* line = RenderPipe::acquire(x_offset + pDraw->iX, y_offset + y, w, 1);
+    for (int x = 0; x < w; x++) {
+        line[x] = pDraw->pPalette[pDraw->pPixels[x]];
     }
-    ::display.pushImage(x_offset + pDraw->iX, y_offset + y, pDraw->iWidth, 1, lineBuffer);
+    RenderPipe::submit();
 }
 
-static bool downloadImageToSD(const String& serverAddr, const String& remoteFilename) {
-    String url = "http://" + serverAddr + ":6969/images/" + remoteFilename;
+// Decode a JPEG held in memory to the panel, scaled down to fit and centred
+bool ImageHandler::drawJpg(uint8_t* buf, size_t len) {
+    return ImageScale::drawJpeg(jpeg, buf, len);
+}
+
+static bool downloadImageToSD(const String& remoteFilename) {
+    char url[ENDPOINT_URL_MAX + 64];
     String sdPath = "/images/" + remoteFilename;
-    Serial.printf("[ImageDL] Downloading from: %s\n", url.c_str());
+    if (!Endpoint::url(url, sizeof(url), sdPath.c_str())) {
+        Serial.println("[ImageDL] No server configured");
+        return false;
+    }
+    Serial.printf("[ImageDL] Downloading from: %s\n", url);
 
     if (!SD_MMC.exists("/images")) {
         Serial.println("[ImageDL] /images/ does not exist. Creating...");
@@ -71,13 +99,17 @@ static bool downloadImageToSD(const String& serverAddr, const String& remoteFile
         }
     }
 
+    unsigned long t0 = millis();
     HTTPClient http;
     http.begin(url);
     int httpCode = http.GET();
     Serial.printf("[ImageDL] HTTP GET returned: %d\n", httpCode);
     if (httpCode == 200) {
-        File file = SD_MMC.open(sdPath, FILE_WRITE);
-        if (!file) {
+        // Network reads come in whatever sizes arrive; the writer turns them
+        // into whole-buffer, sector-aligned SD writes
+        int expected = http.getSize();
+        SdWriter file;
+        if (!file.open(sdPath.c_str(), expected > 0 ? expected : 0)) {
             Serial.printf("[ImageDL] SD open failed for: %s\n", sdPath.c_str());
             http.end();
             return false;
@@ -90,15 +122,34 @@ static bool downloadImageToSD(const String& serverAddr, const String& remoteFile
             if (avail) {
                 int read = stream->readBytes(buf, (avail > sizeof(buf)) ? sizeof(buf) : avail);
                 if (read > 0) {
-                    file.write(buf, read);
+                    if (file.write(buf, read) != (size_t)read) break;
                     total += read;
                 }
+            } else if (expected > 0 && total >= expected) {
+                break;
             } else {
                 delay(1);
             }
         }
-        file.flush();
-        file.close();
+        // A failed flush or a connection dropped mid-body leaves a partial
+        // file that the preallocation would make look complete
+        bool closed = file.close();
+        if (!closed || (expected > 0 && total != expected)) {
+            Serial.printf("[ImageDL] %s: got %d of %d bytes%s, removed\n", sdPath.c_str(), total, expected,
+                          closed ? "" : ", SD write failed");
+            SdStats::remove(sdPath);
+            http.end();
+            return false;
+        }
+        uint32_t ms = millis() - t0;
+        Metrics::inc(Metrics::Counter::ImageDownloads);
+        Metrics::inc(Metrics::Counter::ImageDownloadBytes, total);
+        SdStats::added(total);
+        Metrics::observe(Metrics::Hist::ImageDownloadMs, ms);
+        if (ms) Metrics::observe(Metrics::Hist::ImageDownloadKBps, (uint32_t)((uint64_t)total * 1000 / 1024 / ms));
+        FileIndex::invalidate("/images");
+        Thumbs::invalidate(remoteFilename);
+        Thumbs::request(remoteFilename);
 
         File check = SD_MMC.open(sdPath, FILE_READ);
         if (!check || check.size() == 0) {
@@ -111,7 +162,7 @@ static bool downloadImageToSD(const String& serverAddr, const String& remoteFile
         http.end();
         return true;
     } else {
-        Serial.printf("[ImageDL] HTTP failed, code: %d for %s\n", httpCode, url.c_str());
+        Serial.printf("[ImageDL] HTTP failed, code: %d for %s\n", httpCode, url);
         http.end();
         return false;
     }
@@ -123,8 +174,9 @@ void ImageHandler::stopGifPlayback() {
         gif.close();
         g_gifActive = false;
     }
+    ImageScale::gifEnd();
     if (gifBuffer) {
-        heap_caps_free(gifBuffer);
+        PsramPool::free(gifBuffer);
         gifBuffer = nullptr;
     }
     g_currentGif = "";
@@ -135,12 +187,12 @@ static void stopGifIfActive() {
     ImageHandler::stopGifPlayback();
 }
 
-bool ImageHandler::receive(const String& filename, const String& serverAddr) {
+bool ImageHandler::receive(const String& filename) {
     stopGifIfActive();
     delay(5);
 
     String imagePath = "/images/" + filename;
-    if (!downloadImageToSD(serverAddr, filename)) {
+    if (!downloadImageToSD(filename)) {
         ::display.fillScreen(TFT_BLACK);
         ::display.setTextColor(TFT_WHITE, TFT_BLACK);
         ::display.setTextSize(2);
@@ -188,12 +240,14 @@ bool ImageHandler::display(const String& filename) {
         File jpgFile = SD_MMC.open(path, FILE_READ);
         if (jpgFile && jpgFile.size() > 0) {
             size_t jpgSize = jpgFile.size();
-            uint8_t* jpgBuffer = (uint8_t*)heap_caps_malloc(jpgSize, MALLOC_CAP_SPIRAM);
+            uint8_t* jpgBuffer = (uint8_t*)PsramPool::alloc(jpgSize);
             if (jpgBuffer) {
+                unsigned long r0 = micros();
                 size_t nRead = jpgFile.read(jpgBuffer, jpgSize);
+                Metrics::observe(Metrics::Hist::SdReadUs, micros() - r0);
                 jpgFile.close();
-                ::display.drawJpg(jpgBuffer, jpgSize, 0, 0, ::display.width(), ::display.height());
-                heap_caps_free(jpgBuffer);
+                ImageHandler::drawJpg(jpgBuffer, nRead);
+                PsramPool::free(jpgBuffer);
                 return true;
             }
             jpgFile.close();
@@ -226,18 +280,21 @@ void ImageHandler_updateGif() {
             return;
         }
         gifSize = f.size();
-        gifBuffer = (uint8_t*)heap_caps_malloc(gifSize, MALLOC_CAP_SPIRAM);
+        gifBuffer = (uint8_t*)PsramPool::alloc(gifSize);
         if (gifBuffer) {
+            unsigned long r0 = micros();
             size_t readLen = f.read(gifBuffer, gifSize);
+            Metrics::observe(Metrics::Hist::SdReadUs, micros() - r0);
             f.close();
             gif.begin(GIF_PALETTE_RGB565_BE);
             if (gif.open("", GIFOpenRAM, GIFCloseRAM, GIFReadRAM, GIFSeekRAM, GIFDraw)) {
+                ImageScale::gifBegin(gif.getCanvasWidth(), gif.getCanvasHeight());
                 g_gifActive = true;
                 g_gifStop = false;
                 frameDelay = 0;
                 lastFrame = millis();
             } else {
-                heap_caps_free(gifBuffer);
+                PsramPool::free(gifBuffer);
                 gifBuffer = nullptr;
                 g_gifActive = false;
             }
@@ -247,17 +304,28 @@ void ImageHandler_updateGif() {
 
     if (g_gifActive && !g_gifStop) {
         if (millis() - lastFrame >= (unsigned int)frameDelay) {
+            static uint32_t frames = 0, frameUs = 0;
+            unsigned long t0 = micros();
             if (!gif.playFrame(true, &frameDelay)) {
                 gif.reset();
                 gif.playFrame(true, &frameDelay);
             }
+            RenderPipe::flush();
+            uint32_t us = micros() - t0;
+            Metrics::observe(Metrics::Hist::GifFrameUs, us);
+            frameUs += us;
+            if (++frames == 100) {
+                Serial.printf("[Image] GIF avg decode+draw %lu us/frame\n", (unsigned long)(frameUs / frames));
+                frames = frameUs = 0;
+            }
             lastFrame = millis();
             yield();
         }
     } else if (g_gifActive && g_gifStop) {
         gif.close();
+        ImageScale::gifEnd();
         if (gifBuffer) {
-            heap_caps_free(gifBuffer);
+            PsramPool::free(gifBuffer);
             gifBuffer = nullptr;
         }
         g_gifActive = false;
@@ -285,8 +353,10 @@ std::vector<String> ImageHandler::getAllFilenames() {
 void ImageHandler::clearAll() {
     auto files = getAllFilenames();
     for (auto& f : files) {
-        SD_MMC.remove("/images/" + f);
+        SdStats::remove("/images/" + f);
+        Thumbs::invalidate(f);
     }
+    FileIndex::invalidate("/images");
 }
 
 void ImageHandler::showIncomingNotification() {
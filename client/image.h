@@ -20,11 +20,14 @@ void ImageHandler_updateGif();
 
 namespace ImageHandler {
     // Always download from server, then display (JPG or GIF)
-    bool receive(const String& filename, const String& serverAddr);
+    bool receive(const String& filename);
 
     // Display image/GIF from SD (does not download)
     bool display(const String& filename);
 
+    // Decode an in-memory JPEG to the panel through the render pipeline
+    bool drawJpg(uint8_t* buf, size_t len);
+
     // Always download, then display (alias for receive)
     bool displayWithDownload(const String& filename, const String& serverAddr);
 
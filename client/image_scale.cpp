@@ -0,0 +1,278 @@
+#include "image_scale.h"
+#include "metrics.h"
+#include "settings.h"
+#include "render_pipe.h"
+#include "psram_pool.h"
+
+static inline uint16_t swap16(uint16_t v) { return (v << 8) | (v >> 8); }
+
+ImageScale::Fit ImageScale::fit(int srcW, int srcH) {
+    int pw = ::display.width(), ph = ::display.height();
+    Fit f;
+    if (srcW <= pw && srcH <= ph) {
+        f.w = srcW;
+        f.h = srcH;
+    } else if ((int32_t)srcW * ph > (int32_t)srcH * pw) {     // width-limited
+        f.w = pw;
+        f.h = (int32_t)srcH * pw / srcW;
+    } else {
+        f.h = ph;
+        f.w = (int32_t)srcW * ph / srcH;
+    }
+    if (f.w < 1) f.w = 1;
+    if (f.h < 1) f.h = 1;
+    f.x = (pw - f.w) / 2;
+    f.y = (ph - f.h) / 2;
+    return f;
+}
+
+// --- JPEG ---
+
+// Per-output-pixel sums of little-endian RGB565 channels
+struct AreaAcc { uint16_t r, g, b, n; };
+
+static struct {
+    bool area;              // false: DCT scale was exact, push blocks as-is
+    ImageScale::Fit out;
+    int sw, sh;             // decoded (post-DCT) size
+    AreaAcc* acc;           // out.w * out.h
+    uint16_t* xmap;         // source column -> output column
+} jctx;
+
+static int jpegDraw(JPEGDRAW* d) {
+    if (!jctx.area) {
+        RenderPipe::pushRect(jctx.out.x + d->x, jctx.out.y + d->y, d->iWidth, d->iHeight, d->pPixels);
+        return 1;
+    }
+    int xEnd = d->x + d->iWidth < jctx.sw ? d->x + d->iWidth : jctx.sw;
+    for (int j = 0; j < d->iHeight; ++j) {
+        int sy = d->y + j;
+        if (sy >= jctx.sh) break;
+        AreaAcc* row = jctx.acc + (sy * jctx.out.h / jctx.sh) * jctx.out.w;
+        const uint16_t* src = d->pPixels + j * d->iWidth;
+        for (int sx = d->x; sx < xEnd; ++sx) {
+            uint16_t p = src[sx - d->x];
+            AreaAcc& a = row[jctx.xmap[sx]];
+            a.r += p >> 11;
+            a.g += (p >> 5) & 0x3F;
+            a.b += p & 0x1F;
+            a.n++;
+        }
+    }
+    return 1;
+}
+
+// Average the accumulator into panel tiles
+static void pushArea() {
+    const ImageScale::Fit& o = jctx.out;
+    int rowsPerTile = RENDER_TILE_PX / o.w;
+    for (int y = 0; y < o.h; y += rowsPerTile) {
+        int rows = o.h - y < rowsPerTile ? o.h - y : rowsPerTile;
+        uint16_t* dst = RenderPipe::acquire(o.x, o.y + y, o.w, rows);
+        const AreaAcc* a = jctx.acc + y * o.w;
+        for (int i = 0; i < rows * o.w; ++i, ++a) {
+            if (!a->n) {    // edge column/row the decoder's rounding left empty
+                dst[i] = i ? dst[i - 1] : 0;
+                continue;
+            }
+            uint16_t n = a->n, h = n / 2;
+            uint16_t p = ((a->r + h) / n) << 11 | ((a->g + h) / n) << 5 | ((a->b + h) / n);
+            dst[i] = swap16(p);
+        }
+        RenderPipe::submit();
+    }
+}
+
+bool ImageScale::drawJpeg(JPEGDEC& dec, uint8_t* buf, size_t len) {
+    unsigned long t0 = millis();
+    if (!dec.openRAM(buf, len, jpegDraw)) return false;
+    int w = dec.getWidth(), h = dec.getHeight();
+    jctx.out = fit(w, h);
+
+    // Biggest DCT reduction that doesn't undershoot the target
+    int scale = 1, opt = 0;
+    if (w >= jctx.out.w * 8 && h >= jctx.out.h * 8)      { scale = 8; opt = JPEG_SCALE_EIGHTH; }
+    else if (w >= jctx.out.w * 4 && h >= jctx.out.h * 4) { scale = 4; opt = JPEG_SCALE_QUARTER; }
+    else if (w >= jctx.out.w * 2 && h >= jctx.out.h * 2) { scale = 2; opt = JPEG_SCALE_HALF; }
+    jctx.sw = (w + scale - 1) / scale;
+    jctx.sh = (h + scale - 1) / scale;
+    jctx.area = jctx.sw != jctx.out.w || jctx.sh != jctx.out.h;
+
+    if (jctx.area && (jctx.sw > jctx.out.w * IMAGE_SCALE_MAX_RATIO || jctx.sh > jctx.out.h * IMAGE_SCALE_MAX_RATIO)) {
+        Serial.printf("[Scale] JPEG %dx%d too large to fit\n", w, h);
+        dec.close();
+        return false;
+    }
+    if (jctx.area) {
+        jctx.acc = (AreaAcc*)PsramPool::alloc((size_t)jctx.out.w * jctx.out.h * sizeof(AreaAcc));
+        jctx.xmap = (uint16_t*)PsramPool::alloc(jctx.sw * sizeof(uint16_t));
+        if (!jctx.acc || !jctx.xmap) {
+            PsramPool::free(jctx.acc); PsramPool::free(jctx.xmap);
+            jctx.acc = nullptr; jctx.xmap = nullptr;
+            dec.close();
+            return false;
+        }
+        memset(jctx.acc, 0, (size_t)jctx.out.w * jctx.out.h * sizeof(AreaAcc));
+        for (int x = 0; x < jctx.sw; ++x) jctx.xmap[x] = x * jctx.out.w / jctx.sw;
+    }
+
+    // Letterbox: clear what the image won't cover
+    if (jctx.out.w < ::display.width() || jctx.out.h < ::display.height()) {
+        RenderPipe::flush();
+        ::display.fillScreen(TFT_BLACK);
+    }
+
+    dec.setPixelType(jctx.area ? RGB565_LITTLE_ENDIAN : RGB565_BIG_ENDIAN);
+    bool ok = dec.decode(0, 0, opt);
+    dec.close();
+    if (jctx.area) {
+        if (ok) pushArea();
+        PsramPool::free(jctx.acc); PsramPool::free(jctx.xmap);
+        jctx.acc = nullptr; jctx.xmap = nullptr;
+    }
+    RenderPipe::flush();
+    Metrics::observe(Metrics::Hist::JpegDecodeMs, millis() - t0);
+    Serial.printf("[Scale] JPEG %dx%d -> 1/%d -> %dx%d%s in %lu ms\n", w, h, scale,
+        jctx.out.w, jctx.out.h, jctx.area ? " (area)" : "", millis() - t0);
+    return ok;
+}
+
+// --- GIF ---
+
+// Source sample for one output column/row: the pixel under the cell's
+// centre, and for bilinear the two neighbours and the weight (0..256) of
+// the second
+struct Tap { uint16_t n, a, b; uint16_t w; };
+
+static struct {
+    bool active = false;
+    ImageScale::Filter filter;
+    ImageScale::Fit out;
+    int cw, ch;
+    Tap* xt;        // out.w
+    Tap* yt;        // out.h
+    uint16_t* cur;  // current and previous canvas lines, LE RGB565
+    uint16_t* prev;
+    int prevY;
+} gctx;
+
+static void buildTaps(Tap* t, int outLen, int srcLen) {
+    for (int i = 0; i < outLen; ++i) {
+        t[i].n = (uint32_t)(2 * i + 1) * srcLen / (2 * outLen);
+        // Pixel-centre mapping in 24.8 fixed point
+        int32_t f = (((2 * i + 1) * srcLen * 256) / (2 * outLen)) - 128;
+        if (f < 0) f = 0;
+        int a = f >> 8;
+        if (a >= srcLen - 1) { t[i].a = t[i].b = srcLen - 1; t[i].w = 0; continue; }
+        t[i].a = a;
+        t[i].b = a + 1;
+        t[i].w = f & 0xFF;
+    }
+}
+
+static inline uint16_t lerp565(uint16_t p, uint16_t q, uint16_t w) {
+    if (!w) return p;
+    uint16_t iw = 256 - w;
+    uint16_t r = ((p >> 11) * iw + (q >> 11) * w) >> 8;
+    uint16_t g = (((p >> 5) & 0x3F) * iw + ((q >> 5) & 0x3F) * w) >> 8;
+    uint16_t b = ((p & 0x1F) * iw + (q & 0x1F) * w) >> 8;
+    return r << 11 | g << 5 | b;
+}
+
+bool ImageScale::gifBegin(int canvasW, int canvasH, Filter filter) {
+    gifEnd();
+    Fit f = fit(canvasW, canvasH);
+    if (f.w == canvasW && f.h == canvasH) return false;
+
+    gctx.xt = (Tap*)PsramPool::alloc(f.w * sizeof(Tap));
+    gctx.yt = (Tap*)PsramPool::alloc(f.h * sizeof(Tap));
+    gctx.cur = (uint16_t*)malloc(canvasW * sizeof(uint16_t));
+    gctx.prev = (uint16_t*)malloc(canvasW * sizeof(uint16_t));
+    if (!gctx.xt || !gctx.yt || !gctx.cur || !gctx.prev) {
+        gifEnd();
+        return false;
+    }
+    gctx.filter = filter;
+    gctx.out = f;
+    gctx.cw = canvasW;
+    gctx.ch = canvasH;
+    gctx.prevY = -2;
+    buildTaps(gctx.xt, f.w, canvasW);
+    buildTaps(gctx.yt, f.h, canvasH);
+    gctx.active = true;
+
+    RenderPipe::flush();
+    ::display.fillScreen(TFT_BLACK);
+    Serial.printf("[Scale] GIF %dx%d -> %dx%d (%s)\n", canvasW, canvasH, f.w, f.h,
+        filter == Filter::Bilinear ? "bilinear" : "nearest");
+    return true;
+}
+
+void ImageScale::gifEnd() {
+    PsramPool::free(gctx.xt); PsramPool::free(gctx.yt); free(gctx.cur); free(gctx.prev);
+    gctx.xt = gctx.yt = nullptr;
+    gctx.cur = gctx.prev = nullptr;
+    gctx.active = false;
+}
+
+bool ImageScale::gifScaling() { return gctx.active; }
+
+// Emit output row ty from the lines held; rows whose upper neighbour isn't
+// available (first line of a frame rect, interlaced passes) use cur alone
+static void gifEmitRow(GIFDRAW* d, int ty, bool blendRows, uint16_t wy) {
+    int x0 = d->iX, x1 = d->iX + d->iWidth - 1;
+    // Output columns whose source pixel lies in [x0, x1]
+    int tx = x0 * gctx.out.w / gctx.cw;
+    while (tx > 0 && gctx.xt[tx - 1].n >= x0) --tx;
+    while (tx < gctx.out.w && gctx.xt[tx].n < x0) ++tx;
+    int txEnd = tx;
+    while (txEnd < gctx.out.w && gctx.xt[txEnd].n <= x1) ++txEnd;
+    int n = txEnd - tx;
+    if (n <= 0) return;
+
+    uint16_t* dst = RenderPipe::acquire(gctx.out.x + tx, gctx.out.y + ty, n, 1);
+    for (int i = 0; i < n; ++i) {
+        const Tap& t = gctx.xt[tx + i];
+        uint16_t p;
+        if (gctx.filter == ImageScale::Filter::Nearest) {
+            p = gctx.cur[t.n];
+        } else {
+            int a = t.a < x0 ? x0 : t.a, b = t.b > x1 ? x1 : t.b;
+            p = lerp565(gctx.cur[a], gctx.cur[b], t.w);
+            if (blendRows) p = lerp565(lerp565(gctx.prev[a], gctx.prev[b], t.w), p, wy);
+        }
+        dst[i] = swap16(p);
+    }
+    RenderPipe::submit();
+}
+
+void ImageScale::gifLine(GIFDRAW* d) {
+    int y = d->iY + d->y;
+    if (y < 0 || y >= gctx.ch || d->iX >= gctx.cw) return;
+    if (d->iX + d->iWidth > gctx.cw) d->iWidth = gctx.cw - d->iX;
+
+    // Palette lookup into the canvas-indexed line buffer
+    uint16_t* line = gctx.cur + d->iX;
+    for (int x = 0; x < d->iWidth; ++x) line[x] = swap16(d->pPalette[d->pPixels[x]]);
+
+    bool consecutive = d->y > 0 && gctx.prevY == y - 1;
+    bool lastLine = d->y == d->iHeight - 1;
+    int guess = y * gctx.out.h / gctx.ch;
+    int from = guess > 2 ? guess - 2 : 0;
+    int to = guess + 2 < gctx.out.h ? guess + 2 : gctx.out.h - 1;
+    for (int ty = from; ty <= to; ++ty) {
+        const Tap& t = gctx.yt[ty];
+        if (gctx.filter == Filter::Nearest) {
+            if (t.n == y) gifEmitRow(d, ty, false, 0);
+        } else if (t.b == y && t.a != t.b) {
+            gifEmitRow(d, ty, consecutive, t.w);        // needs a (prev) and b (cur)
+        } else if (t.a == y && (t.a == t.b || lastLine)) {
+            gifEmitRow(d, ty, false, 0);                // bottom edge of canvas or rect
+        }
+    }
+
+    uint16_t* tmp = gctx.prev;
+    gctx.prev = gctx.cur;
+    gctx.cur = tmp;
+    gctx.prevY = y;
+}
@@ -0,0 +1,32 @@
+// image_scale.h
+#pragma once
+
+#include <Arduino.h>
+#include <JPEGDEC.h>
+#include <AnimatedGIF.h>
+
+// Fits images that were not pre-sized by the server onto the panel (never
+// enlarging, centred, aspect kept). JPEGs are reduced by the decoder's DCT
+// scaling (1/2, 1/4, 1/8) first, then box/area-averaged for the remaining
+// factor. GIF frames are scaled line by line as GIFDraw delivers them.
+
+#define IMAGE_SCALE_MAX_RATIO  16   // max post-DCT reduction of the area pass
+
+namespace ImageScale {
+    enum class Filter : uint8_t { Nearest, Bilinear };
+
+    struct Fit { int16_t x, y, w, h; };
+
+    // Largest size that fits the panel (source size if it already fits), centred
+    Fit fit(int srcW, int srcH);
+
+    // Decode a JPEG held in memory onto the panel, fitted and centred
+    bool drawJpeg(JPEGDEC& dec, uint8_t* buf, size_t len);
+
+    // GIF: call after gif.open(). Returns true if frames need scaling; GIFDraw
+    // then hands every line to gifLine() instead of drawing it 1:1.
+    bool gifBegin(int canvasW, int canvasH, Filter filter = Filter::Bilinear);
+    void gifEnd();
+    bool gifScaling();
+    void gifLine(GIFDRAW* d);   // palette must be GIF_PALETTE_RGB565_BE
+}
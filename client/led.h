@@ -1,7 +1,7 @@
 // led.h
 #pragma once
 
-#include <stdint.h>
+#include <Arduino.h>
 
 enum class LedMode {
     BootBlink,
@@ -19,9 +19,16 @@ namespace Led {
     void setColor(uint32_t rgb);
     uint32_t getColor();
 
+    // Colour on the LED right now (effects applied, before brightness/gamma)
+    uint32_t getOutput();
+
     void setBrightness(uint8_t b);
     uint8_t getBrightness();
 
     void heartbeat(uint32_t rgb, uint8_t pulses);
+
+    // Play a keyframe effect: inline JSON or the name of /res/fx/<name>.json
+    bool playEffect(const String& spec);
+
     void loop();
 }
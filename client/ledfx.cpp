@@ -0,0 +1,239 @@
+#include "ledfx.h"
+#include <SD_MMC.h>
+
+// Per-layer playback state. The track is copied in so callers can build
+// tracks on the stack.
+struct LayerState {
+    LedFx::Track track;
+    bool on = false;
+    bool fading = false;
+    uint8_t playsLeft = 0;
+    uint32_t total = 0;             // sum of key durations
+    unsigned long playStart = 0;
+    unsigned long fadeStart = 0;
+    uint32_t lastRgb = 0;
+    uint8_t lastAlpha = 0;
+};
+
+static LayerState layers[LEDFX_LAYERS];
+
+// play()/stop() can be called from web handlers on the other core
+static portMUX_TYPE fxMux = portMUX_INITIALIZER_UNLOCKED;
+
+bool LedFx::Track::add(uint32_t rgb, uint16_t ms, Ease e, uint8_t alpha) {
+    if (count >= LEDFX_MAX_KEYS) return false;
+    keys[count++] = { rgb & 0xFFFFFF, alpha, e, ms };
+    return true;
+}
+
+// -- Integer helpers --
+static inline uint8_t lerp8(uint8_t a, uint8_t b, uint8_t t) {
+    return (uint8_t)(a + (((int)b - (int)a) * t + 127) / 255);
+}
+
+static inline uint32_t lerpRgb(uint32_t a, uint32_t b, uint8_t t) {
+    return ((uint32_t)lerp8((a >> 16) & 0xFF, (b >> 16) & 0xFF, t) << 16) |
+           ((uint32_t)lerp8((a >> 8) & 0xFF, (b >> 8) & 0xFF, t) << 8) |
+           lerp8(a & 0xFF, b & 0xFF, t);
+}
+
+static uint8_t ease(LedFx::Ease e, uint8_t t) {
+    uint32_t x = t;
+    switch (e) {
+        case LedFx::Ease::Step:   return 255;
+        case LedFx::Ease::In:     return (uint8_t)((x * x) / 255);
+        case LedFx::Ease::Out:    return (uint8_t)(255 - ((255 - x) * (255 - x)) / 255);
+        case LedFx::Ease::InOut:  return (uint8_t)((x * x * (765 - 2 * x)) / 65025);
+        default:                  return t;
+    }
+}
+
+// -- Layer control --
+void LedFx::play(uint8_t layer, const Track& t, unsigned long now) {
+    if (layer >= LEDFX_LAYERS || t.count == 0) return;
+    uint32_t total = 0;
+    for (uint8_t i = 0; i < t.count; ++i) total += t.keys[i].ms;
+
+    portENTER_CRITICAL(&fxMux);
+    LayerState& L = layers[layer];
+    L.track = t;
+    L.total = total;
+    L.playsLeft = t.repeat;
+    L.playStart = now;
+    L.fading = false;
+    L.on = true;
+    portEXIT_CRITICAL(&fxMux);
+}
+
+void LedFx::stop(uint8_t layer) {
+    if (layer >= LEDFX_LAYERS) return;
+    portENTER_CRITICAL(&fxMux);
+    layers[layer].on = false;
+    portEXIT_CRITICAL(&fxMux);
+}
+
+bool LedFx::active(uint8_t layer) {
+    return layer < LEDFX_LAYERS && layers[layer].on;
+}
+
+// Advance a layer to `now` and write its colour/alpha. Returns false once
+// the layer has nothing left to show.
+static bool stepLayer(LayerState& L, unsigned long now, uint32_t& rgb, uint8_t& alpha) {
+    const LedFx::Track& T = L.track;
+
+    if (L.fading) {
+        unsigned long f = now - L.fadeStart;
+        if (f >= T.fadeOut) { L.on = false; return false; }
+        rgb = L.lastRgb;
+        alpha = (uint8_t)(L.lastAlpha - (L.lastAlpha * f) / T.fadeOut);
+        return true;
+    }
+
+    // A track with no duration just holds its last key
+    if (L.total == 0) {
+        const LedFx::Keyframe& k = T.keys[T.count - 1];
+        rgb = k.rgb; alpha = k.alpha;
+        return true;
+    }
+
+    unsigned long elapsed = now - L.playStart;
+
+    // Whole plays are skipped arithmetically, so a long stall costs nothing
+    if (elapsed >= L.total) {
+        uint32_t plays = elapsed / L.total;
+        if (L.playsLeft && plays >= L.playsLeft) {
+            const LedFx::Keyframe& last = T.keys[T.count - 1];
+            L.lastRgb = last.rgb;
+            L.lastAlpha = last.alpha;
+            if (!T.fadeOut) { L.on = false; return false; }
+            L.fading = true;
+            L.fadeStart = L.playStart + L.playsLeft * L.total;
+            return stepLayer(L, now, rgb, alpha);
+        }
+        if (L.playsLeft) L.playsLeft -= plays;
+        L.playStart += plays * L.total;
+        elapsed -= plays * L.total;
+    }
+
+    // elapsed < total here, so this scan is bounded by LEDFX_MAX_KEYS
+    uint8_t k = 0;
+    while (elapsed >= T.keys[k].ms) elapsed -= T.keys[k++].ms;
+
+    const LedFx::Keyframe& cur = T.keys[k];
+    const LedFx::Keyframe& prev = T.keys[k ? k - 1 : T.count - 1];
+    uint8_t t = ease(cur.ease, (uint8_t)((elapsed * 255) / cur.ms));
+    rgb = lerpRgb(prev.rgb, cur.rgb, t);
+    alpha = lerp8(prev.alpha, cur.alpha, t);
+    return true;
+}
+
+uint32_t LedFx::evaluate(unsigned long now) {
+    uint32_t out = 0;
+    portENTER_CRITICAL(&fxMux);
+    for (uint8_t i = 0; i < LEDFX_LAYERS; ++i) {
+        LayerState& L = layers[i];
+        if (!L.on) continue;
+        uint32_t rgb; uint8_t alpha;
+        if (stepLayer(L, now, rgb, alpha)) out = lerpRgb(out, rgb, alpha);
+    }
+    portEXIT_CRITICAL(&fxMux);
+    return out;
+}
+
+// -- Built-in tracks --
+void LedFx::makeStatic(Track& t, uint32_t rgb) {
+    t.clear();
+    t.add(rgb, 0, Ease::Step);
+}
+
+void LedFx::makeBlink(Track& t, uint32_t rgb, uint16_t periodMs) {
+    t.clear();
+    t.add(rgb, periodMs / 2, Ease::Step);
+    t.add(0, periodMs / 2, Ease::Step);
+}
+
+void LedFx::makeBreathe(Track& t, uint32_t rgb, uint16_t halfMs) {
+    t.clear();
+    t.add(rgb, halfMs, Ease::InOut);
+    t.add(0, halfMs, Ease::InOut);
+}
+
+void LedFx::makeRainbow(Track& t, uint16_t segMs) {
+    static const uint32_t hues[] = { 0xFFFF00, 0x00FF00, 0x00FFFF, 0x0000FF, 0xFF00FF, 0xFF0000 };
+    t.clear();
+    for (uint32_t c : hues) t.add(c, segMs, Ease::Linear);
+}
+
+// ON, OFF, ON, long OFF ... then blend back into whatever is underneath
+void LedFx::makeHeartbeat(Track& t, uint32_t rgb, uint8_t pulses) {
+    if (pulses == 0) pulses = 2;
+    if (pulses > LEDFX_MAX_KEYS / 2) pulses = LEDFX_MAX_KEYS / 2;
+    t.clear();
+    for (uint8_t i = 0; i < pulses; ++i) {
+        t.add(rgb, 80, Ease::Step);
+        t.add(0, (i & 1) ? 300 : 80, Ease::Step);
+    }
+    t.repeat = 1;
+    t.fadeOut = 250;
+}
+
+// -- JSON / SD loading --
+static uint32_t parseColor(JsonVariantConst v) {
+    if (v.is<const char*>()) {
+        const char* s = v.as<const char*>();
+        if (*s == '#') s++;
+        return (uint32_t)strtoul(s, nullptr, 16);
+    }
+    return v.as<uint32_t>();
+}
+
+static LedFx::Ease parseEase(const char* s) {
+    if (!s) return LedFx::Ease::Linear;
+    if (!strcmp(s, "step"))  return LedFx::Ease::Step;
+    if (!strcmp(s, "in"))    return LedFx::Ease::In;
+    if (!strcmp(s, "out"))   return LedFx::Ease::Out;
+    if (!strcmp(s, "inout")) return LedFx::Ease::InOut;
+    return LedFx::Ease::Linear;
+}
+
+bool LedFx::parse(JsonVariantConst v, Track& out, uint8_t& layer) {
+    JsonArrayConst keys = v["keys"];
+    if (keys.isNull() || keys.size() == 0) return false;
+
+    out.clear();
+    for (JsonVariantConst k : keys) {
+        if (!out.add(parseColor(k["c"]), k["ms"] | 0, parseEase(k["e"]), k["a"] | 255)) break;
+    }
+    out.repeat  = v["repeat"] | 0;
+    out.fadeOut = v["fadeOut"] | 0;
+    if (v.containsKey("layer")) {
+        uint8_t l = v["layer"] | 1;
+        layer = l < LEDFX_LAYERS ? l : LEDFX_LAYERS - 1;
+    }
+    return out.count > 0;
+}
+
+bool LedFx::loadFromSD(const String& name, Track& out, uint8_t& layer) {
+    if (name.indexOf('/') >= 0) return false;
+    File f = SD_MMC.open(String(LEDFX_DIR) + "/" + name + ".json", FILE_READ);
+    if (!f) return false;
+    StaticJsonDocument<LEDFX_DOC_SIZE> doc;
+    DeserializationError err = deserializeJson(doc, f);
+    f.close();
+    if (err) return false;
+    return parse(doc.as<JsonVariantConst>(), out, layer);
+}
+
+bool LedFx::playSpec(const String& spec, unsigned long now) {
+    Track t;
+    uint8_t layer = Accent;
+    bool ok;
+    if (spec.startsWith("{")) {
+        StaticJsonDocument<LEDFX_DOC_SIZE> doc;
+        ok = !deserializeJson(doc, spec) && parse(doc.as<JsonVariantConst>(), t, layer);
+    } else {
+        ok = loadFromSD(spec, t, layer);
+    }
+    if (ok) play(layer, t, now);
+    return ok;
+}
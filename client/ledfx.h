@@ -0,0 +1,65 @@
+// ledfx.h
+#pragma once
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+
+// Keyframe LED sequencer. Tracks are plain fixed-size structs so they can be
+// copied into a layer without touching the heap, and a frame is evaluated in
+// constant time per layer.
+
+#define LEDFX_MAX_KEYS   24
+#define LEDFX_LAYERS     3
+#define LEDFX_DIR        "/res/fx"
+#define LEDFX_DOC_SIZE   2048    // JSON document for one track (SD file or request body)
+
+namespace LedFx {
+
+    enum class Ease : uint8_t { Step, Linear, In, Out, InOut };
+
+    // Priority layers, lowest first. Higher layers composite over lower ones.
+    enum Layer : uint8_t { Base = 0, Accent = 1, Alert = 2 };
+
+    struct Keyframe {
+        uint32_t rgb;       // target colour, reached at the end of ms
+        uint8_t  alpha;     // 255 = opaque over lower layers
+        Ease     ease;
+        uint16_t ms;        // time to reach this keyframe from the previous one
+    };
+
+    struct Track {
+        Keyframe keys[LEDFX_MAX_KEYS];
+        uint8_t  count = 0;
+        uint8_t  repeat = 0;    // 0 = loop forever, otherwise number of plays
+        uint16_t fadeOut = 0;   // ms to blend back into lower layers when done
+
+        void clear() { count = 0; repeat = 0; fadeOut = 0; }
+        bool add(uint32_t rgb, uint16_t ms, Ease e = Ease::Linear, uint8_t alpha = 255);
+    };
+
+    // Start/stop a track on a layer (copies the track, no allocation).
+    void play(uint8_t layer, const Track& t, unsigned long now);
+    void stop(uint8_t layer);
+    bool active(uint8_t layer);
+
+    // Composite all active layers for time `now`. Returns packed 0xRRGGBB.
+    uint32_t evaluate(unsigned long now);
+
+    // Parse {"layer":1,"repeat":2,"fadeOut":200,"keys":[{"c":"FF0055","ms":80,"e":"step","a":255},...]}
+    // `layer` is only written if present.
+    bool parse(JsonVariantConst v, Track& out, uint8_t& layer);
+
+    // Load LEDFX_DIR/<name>.json from SD.
+    bool loadFromSD(const String& name, Track& out, uint8_t& layer);
+
+    // Parse a message "ledFx" field: either an inline JSON object or the
+    // name of an SD effect. Plays it on success.
+    bool playSpec(const String& spec, unsigned long now);
+
+    // Built-in tracks
+    void makeStatic(Track& t, uint32_t rgb);
+    void makeBlink(Track& t, uint32_t rgb, uint16_t periodMs);
+    void makeBreathe(Track& t, uint32_t rgb, uint16_t halfMs);
+    void makeRainbow(Track& t, uint16_t segMs);
+    void makeHeartbeat(Track& t, uint32_t rgb, uint8_t pulses);
+}
@@ -1,6 +1,12 @@
 #include "message.h"
 #include "config.h"
 #include "led.h"
+#include "file_index.h"
+#include "metrics.h"
+#include "sd_stats.h"
+#include "sd_writer.h"
+#include "ledfx.h"
+#include "psram_pool.h"
 #include <SD_MMC.h>
 #include <ArduinoJson.h>
 #include <HTTPClient.h>
@@ -13,6 +19,7 @@ extern void displayShowNotification(const String& txt);
 extern void displayShowMessage(const String& txt);
 
 #define MESSAGE_DIR "/messages"
+#define MESSAGE_DOC_SIZE (1024 + LEDFX_DOC_SIZE)   // fields + one inline ledFx track
 
 // -------- PATCH CONTROL: Comment this to DISABLE weather fetch (sets dummy data) --------
 #define ENABLE_WEATHER_FETCH
@@ -42,16 +49,20 @@ static String prettyTime(const String& in) {
 static void fetchWeather(String& weather, String& city, String& country, int& tempF) {
     weather = ""; city = ""; country = ""; tempF = 0;
     DeviceConfig& cfg = Config::get();
-    if (cfg.weatherApiKey.isEmpty() || cfg.weatherPostal.isEmpty() || cfg.weatherCountry.isEmpty()) {
-        return;
-    }
-    String url = "http://api.openweathermap.org/data/2.5/weather?zip=" + cfg.weatherPostal + "," + cfg.weatherCountry + "&appid=" + cfg.weatherApiKey + "&units=imperial";
+    Config::lock();
+    bool configured = !cfg.weatherApiKey.isEmpty() && !cfg.weatherPostal.isEmpty() && !cfg.weatherCountry.isEmpty();
+    String url = configured ? "http://api.openweathermap.org/data/2.5/weather?zip=" + cfg.weatherPostal + "," +
+                              cfg.weatherCountry + "&appid=" + cfg.weatherApiKey + "&units=imperial" : "";
+    Config::unlock();
+    if (!configured) return;
+    unsigned long t0 = millis();
     HTTPClient http;
     http.setTimeout(2000);
     http.begin(url);
     int httpCode = http.GET();
     if (httpCode == 200) {
         String payload = http.getString();
+        Metrics::observe(Metrics::Hist::WeatherMs, millis() - t0);
         StaticJsonDocument<1536> doc;
         auto err = deserializeJson(doc, payload);
         if (err == DeserializationError::Ok) {
@@ -73,8 +84,10 @@ static void applyMessageLedEffect(const Message& msg) {
     Serial.printf("[Message] LED: ledColor=0x%06lx useLed=%d | heartbeat=0x%06lx useHB=%d pulses=%d\n",
         (unsigned long)msg.ledColor, msg.useLedColor, (unsigned long)msg.heartbeatColor, msg.useHeartbeat, msg.heartbeatPulses);
 
-    // Heartbeat takes priority over static color
-    if (msg.useHeartbeat && msg.heartbeatColor != 0 && msg.heartbeatPulses > 0) {
+    // A keyframe effect layers over the current mode; heartbeat takes priority over static color
+    if (msg.ledFx.length() && Led::playEffect(msg.ledFx)) {
+        Serial.println("[Message] Triggering KEYFRAME effect");
+    } else if (msg.useHeartbeat && msg.heartbeatColor != 0 && msg.heartbeatPulses > 0) {
         Serial.println("[Message] Triggering HEARTBEAT effect");
         Led::heartbeat(msg.heartbeatColor, msg.heartbeatPulses);
     } else if (msg.useLedColor && msg.ledColor != 0) {
@@ -88,7 +101,8 @@ static void applyMessageLedEffect(const Message& msg) {
 
 // Save a message with a unique filename and show notification & message
 bool MessageHandler::receive(const String& text, const String& sender, const String& timeReceived,
-                             uint32_t ledColor, bool useLedColor, bool useHeartbeat, uint32_t heartbeatColor, uint8_t heartbeatPulses) {
+                             uint32_t ledColor, bool useLedColor, bool useHeartbeat, uint32_t heartbeatColor, uint8_t heartbeatPulses,
+                             const String& ledFx) {
     ensureDir();
 
     String weather, city, country;
@@ -108,10 +122,8 @@ bool MessageHandler::receive(const String& text, const String& sender, const Str
         filename = base + "_" + String(counter++) + ".txt";
     }
 
-    File file = SD_MMC.open(filename, FILE_WRITE);
-    if (!file) return false;
-
-    StaticJsonDocument<512> doc;
+    // The fields plus a copy of the ledFx text, up to one full inline track
+    PoolJsonDocument doc(MESSAGE_DOC_SIZE);
     doc["text"] = text;
     doc["sender"] = sender;
     doc["time"] = timeReceived;
@@ -129,12 +141,22 @@ bool MessageHandler::receive(const String& text, const String& sender, const Str
     doc["useHeartbeat"] = useHeartbeat;
     doc["heartbeatColor"] = String(hbColorStr);
     doc["heartbeatPulses"] = heartbeatPulses;
+    if (ledFx.length() > LEDFX_DOC_SIZE) {
+        Serial.printf("[Message] ledFx of %u bytes over %d, not saved\n", ledFx.length(), LEDFX_DOC_SIZE);
+    } else if (ledFx.length()) {
+        doc["ledFx"] = ledFx;
+    }
 
-    if (serializeJson(doc, file) == 0) {
-        file.close();
+    // One buffered write instead of serializeJson's byte-at-a-time File writes
+    SdWriter file(SD_WRITER_MIN);
+    if (!file.open(filename.c_str(), measureJson(doc))) return false;
+    size_t written = serializeJson(doc, file);
+    if (!file.close() || written == 0) {
+        SdStats::remove(filename);
         return false;
     }
-    file.close();
+    SdStats::added(written);
+    FileIndex::invalidate(MESSAGE_DIR);
 
     displayShowNotification("Incoming LoveByte!");
     delay(500);
@@ -146,6 +168,7 @@ bool MessageHandler::receive(const String& text, const String& sender, const Str
     msg.useHeartbeat = useHeartbeat;
     msg.heartbeatColor = heartbeatColor;
     msg.heartbeatPulses = heartbeatPulses;
+    msg.ledFx = ledFx;
     applyMessageLedEffect(msg);
 
     // Now load and show the just-written message
@@ -168,7 +191,7 @@ bool MessageHandler::load(const String& filename, Message& out) {
     File file = SD_MMC.open(fullpath, FILE_READ);
     if (!file) return false;
 
-    StaticJsonDocument<512> doc;
+    PoolJsonDocument doc(MESSAGE_DOC_SIZE);
     DeserializationError err = deserializeJson(doc, file);
     file.close();
     if (err) return false;
@@ -202,6 +225,7 @@ bool MessageHandler::load(const String& filename, Message& out) {
     }
 
     out.heartbeatPulses = doc["heartbeatPulses"] | 0;
+    out.ledFx = doc["ledFx"] | "";
 
     return true;
 }
@@ -248,12 +272,14 @@ String MessageHandler::formatForDisplay(const Message& msg) {
 bool MessageHandler::remove(size_t idx) {
     auto files = MessageHandler::getAllFilenames();
     if (idx >= files.size()) return false;
-    return SD_MMC.remove(files[idx]);
+    FileIndex::invalidate(MESSAGE_DIR);
+    return SdStats::remove(files[idx]);
 }
 
 bool MessageHandler::remove(const String& filename) {
     String fullpath = filename.startsWith("/") ? filename : String(MESSAGE_DIR) + "/" + filename;
-    return SD_MMC.remove(fullpath);
+    FileIndex::invalidate(MESSAGE_DIR);
+    return SdStats::remove(fullpath);
 }
 
 std::vector<String> MessageHandler::getAllFilenames() {
@@ -280,7 +306,8 @@ void MessageHandler::listFilenames(String* arr, size_t max, size_t& actual) {
 
 void MessageHandler::clearAll() {
     auto files = getAllFilenames();
-    for (auto& f : files) SD_MMC.remove(f);
+    for (auto& f : files) SdStats::remove(f);
+    FileIndex::invalidate(MESSAGE_DIR);
 }
 
 void MessageHandler::showIncomingNotification() {
@@ -22,6 +22,9 @@ struct Message {
     uint32_t heartbeatColor = 0;  // RGB value for heartbeat
     uint8_t heartbeatPulses = 0;  // Number of pulses
 
+    // Keyframe effect: inline JSON track or name of /res/fx/<name>.json
+    String ledFx;
+
     // --- PATCH: If you need a pretty print helper ---
     String prettyTime(const String& in);
 };
@@ -39,7 +42,8 @@ namespace MessageHandler {
         bool useLedColor,
         bool useHeartbeat,
         uint32_t heartbeatColor,
-        uint8_t heartbeatPulses
+        uint8_t heartbeatPulses,
+        const String& ledFx = ""
     );
 
     // Load a message by index or filename.
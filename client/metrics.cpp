@@ -0,0 +1,124 @@
+#include "metrics.h"
+#include "boot_profile.h"
+#include "psram_pool.h"
+#include "web_arena.h"
+#include <atomic>
+#include <esp_heap_caps.h>
+#include <esp_timer.h>
+
+using Metrics::Counter;
+using Metrics::Hist;
+
+static const uint32_t MS_BOUNDS[]    = { 5, 10, 25, 50, 100, 250, 500, 1000, 2500, 5000, 10000 };
+static const uint32_t US_BOUNDS[]    = { 100, 250, 500, 1000, 2500, 5000, 10000, 25000, 50000, 100000, 250000 };
+static const uint32_t COUNT_BOUNDS[] = { 0, 1, 2, 5, 10, 20 };
+static const uint32_t KBPS_BOUNDS[]  = { 16, 32, 64, 128, 256, 512, 1024, 2048 };
+#define BOUNDS(b) b, sizeof(b) / sizeof(b[0])
+#define MAX_BUCKETS 12      // largest bounds table + the +Inf bucket
+
+struct CounterDef { const char* name; const char* help; };
+struct HistDef { const char* name; const char* help; const uint32_t* bounds; uint8_t n; };
+
+static const CounterDef COUNTERS[] = {
+    { "lovebyte_pulls_total",                "Server message pulls" },
+    { "lovebyte_pull_errors_total",          "Pulls that did not return 200" },
+    { "lovebyte_pull_bytes_total",           "Bytes received from pulls" },
+    { "lovebyte_image_downloads_total",      "Images downloaded from the server" },
+    { "lovebyte_image_download_bytes_total", "Image bytes downloaded" },
+    { "lovebyte_wifi_reconnects_total",      "Wi-Fi reconnections after boot" },
+    { "lovebyte_config_writes_total",        "NVS writes made by the config store" },
+};
+
+static const HistDef HISTS[] = {
+    { "lovebyte_pull_ms",                "Pull round trip, ms",           BOUNDS(MS_BOUNDS) },
+    { "lovebyte_pull_messages",          "Messages per pull",             BOUNDS(COUNT_BOUNDS) },
+    { "lovebyte_weather_fetch_ms",       "Weather fetch, ms",             BOUNDS(MS_BOUNDS) },
+    { "lovebyte_image_download_ms",      "Image download, ms",            BOUNDS(MS_BOUNDS) },
+    { "lovebyte_image_download_kbps",    "Image download speed, KB/s",    BOUNDS(KBPS_BOUNDS) },
+    { "lovebyte_jpeg_decode_ms",         "JPEG decode and draw, ms",      BOUNDS(MS_BOUNDS) },
+    { "lovebyte_gif_frame_us",           "GIF frame decode and draw, us", BOUNDS(US_BOUNDS) },
+    { "lovebyte_sd_read_us",             "SD read call, us",              BOUNDS(US_BOUNDS) },
+    { "lovebyte_sd_write_us",            "SD write call, us",             BOUNDS(US_BOUNDS) },
+    { "lovebyte_loop_us",                "loop() iteration, us",          BOUNDS(US_BOUNDS) },
+    { "lovebyte_wifi_connect_ms",        "Wi-Fi (re)connect, ms",         BOUNDS(MS_BOUNDS) },
+};
+
+static_assert(sizeof(COUNTERS) / sizeof(COUNTERS[0]) == (size_t)Counter::Count, "counter table");
+static_assert(sizeof(HISTS) / sizeof(HISTS[0]) == (size_t)Hist::Count, "histogram table");
+
+struct HistData {
+    std::atomic<uint32_t> buckets[MAX_BUCKETS];     // non-cumulative; last is +Inf
+    std::atomic<uint32_t> sumLo, sumHi;             // 64-bit sum without 64-bit atomics
+};
+
+static std::atomic<uint32_t> counters[(size_t)Counter::Count];
+static HistData hists[(size_t)Hist::Count];
+
+void Metrics::inc(Counter c, uint32_t n) {
+    counters[(size_t)c].fetch_add(n, std::memory_order_relaxed);
+}
+
+void Metrics::observe(Hist h, uint32_t value) {
+    const HistDef& d = HISTS[(size_t)h];
+    HistData& s = hists[(size_t)h];
+    uint8_t i = 0;
+    while (i < d.n && value > d.bounds[i]) ++i;
+    s.buckets[i].fetch_add(1, std::memory_order_relaxed);
+    uint32_t old = s.sumLo.fetch_add(value, std::memory_order_relaxed);
+    if (old + value < old) s.sumHi.fetch_add(1, std::memory_order_relaxed);
+}
+
+void Metrics::loopTick() {
+    static uint32_t last = 0;
+    uint32_t now = micros();
+    if (last) observe(Hist::LoopUs, now - last);
+    last = now;
+}
+
+void Metrics::write(Print& out) {
+    for (size_t i = 0; i < (size_t)Counter::Count; ++i) {
+        const CounterDef& d = COUNTERS[i];
+        out.printf("# HELP %s %s\n# TYPE %s counter\n%s %u\n", d.name, d.help, d.name, d.name,
+            (unsigned)counters[i].load(std::memory_order_relaxed));
+    }
+
+    for (size_t i = 0; i < (size_t)Hist::Count; ++i) {
+        const HistDef& d = HISTS[i];
+        HistData& s = hists[i];
+        out.printf("# HELP %s %s\n# TYPE %s histogram\n", d.name, d.help, d.name);
+        uint32_t cum = 0;
+        for (uint8_t b = 0; b < d.n; ++b) {
+            cum += s.buckets[b].load(std::memory_order_relaxed);
+            out.printf("%s_bucket{le=\"%u\"} %u\n", d.name, (unsigned)d.bounds[b], (unsigned)cum);
+        }
+        cum += s.buckets[d.n].load(std::memory_order_relaxed);
+        uint32_t hi, lo;
+        do {
+            hi = s.sumHi.load(std::memory_order_relaxed);
+            lo = s.sumLo.load(std::memory_order_relaxed);
+        } while (hi != s.sumHi.load(std::memory_order_relaxed));
+        out.printf("%s_bucket{le=\"+Inf\"} %u\n%s_sum %llu\n%s_count %u\n", d.name, (unsigned)cum,
+            d.name, ((unsigned long long)hi << 32) | lo, d.name, (unsigned)cum);
+    }
+
+    out.printf("# TYPE lovebyte_heap_free_bytes gauge\nlovebyte_heap_free_bytes %u\n", (unsigned)ESP.getFreeHeap());
+    out.printf("# TYPE lovebyte_heap_min_free_bytes gauge\nlovebyte_heap_min_free_bytes %u\n", (unsigned)ESP.getMinFreeHeap());
+    // Internal RAM fragmentation: what String churn in handlers used to erode
+    multi_heap_info_t info;
+    heap_caps_get_info(&info, MALLOC_CAP_INTERNAL);
+    out.printf("# TYPE lovebyte_heap_largest_free_block_bytes gauge\nlovebyte_heap_largest_free_block_bytes %u\n",
+        (unsigned)info.largest_free_block);
+    out.printf("# TYPE lovebyte_heap_allocated_blocks gauge\nlovebyte_heap_allocated_blocks %u\n",
+        (unsigned)info.allocated_blocks);
+    out.printf("# TYPE lovebyte_heap_free_blocks gauge\nlovebyte_heap_free_blocks %u\n", (unsigned)info.free_blocks);
+    if (ESP.getPsramSize()) {
+        out.printf("# TYPE lovebyte_psram_free_bytes gauge\nlovebyte_psram_free_bytes %u\n", (unsigned)ESP.getFreePsram());
+        out.printf("# TYPE lovebyte_psram_min_free_bytes gauge\nlovebyte_psram_min_free_bytes %u\n",
+            (unsigned)heap_caps_get_minimum_free_size(MALLOC_CAP_SPIRAM));
+    }
+    PsramPool::write(out);
+    WebArena::writeMetrics(out);
+    BootProfile::write(out);
+    out.printf("# TYPE lovebyte_uptime_seconds counter\nlovebyte_uptime_seconds %llu\n",
+        (unsigned long long)(esp_timer_get_time() / 1000000ULL));
+}
@@ -0,0 +1,45 @@
+// metrics.h
+#pragma once
+
+#include <Arduino.h>
+
+// Counters and fixed-bucket histograms for /metrics (Prometheus text
+// format). Recording is a handful of relaxed atomic adds with no locks or
+// allocation, so it is safe from any task and cheap enough to leave on.
+
+namespace Metrics {
+    enum class Counter : uint8_t {
+        Pulls,
+        PullErrors,
+        PullBytes,
+        ImageDownloads,
+        ImageDownloadBytes,
+        WifiReconnects,
+        ConfigWrites,
+        Count
+    };
+
+    enum class Hist : uint8_t {
+        PullMs,
+        PullMessages,
+        WeatherMs,
+        ImageDownloadMs,
+        ImageDownloadKBps,
+        JpegDecodeMs,
+        GifFrameUs,
+        SdReadUs,
+        SdWriteUs,
+        LoopUs,
+        WifiConnectMs,
+        Count
+    };
+
+    void inc(Counter c, uint32_t n = 1);
+    void observe(Hist h, uint32_t value);
+
+    // Call from loop(): one iteration-time sample per call
+    void loopTick();
+
+    // Everything, plus heap/PSRAM low-water marks and uptime
+    void write(Print& out);
+}
@@ -0,0 +1,90 @@
+#include "outbound.h"
+#include "endpoint.h"
+#include "spsc.h"
+#include <HTTPClient.h>
+#include <esp_heap_caps.h>
+
+struct OutJob {
+    uint32_t id;
+    char url[ENDPOINT_URL_MAX];
+    char* body;
+    size_t len;
+};
+
+struct OutResult {
+    uint32_t id;
+    Outbound::Result r;
+};
+
+static SpscRing<OutJob, OUTBOUND_QUEUE> jobs;      // AsyncTCP -> worker
+static OutResult results[OUTBOUND_RESULTS];
+static portMUX_TYPE resultsMux = portMUX_INITIALIZER_UNLOCKED;
+static uint32_t nextId = 0;
+static TaskHandle_t worker = nullptr;
+
+static OutResult* slotFor(uint32_t id) { return &results[id % OUTBOUND_RESULTS]; }
+
+static void setResult(uint32_t id, Outbound::State state, int code, const String& reply) {
+    OutResult* s = slotFor(id);
+    portENTER_CRITICAL(&resultsMux);
+    s->id = id;
+    s->r.state = state;
+    s->r.code = code;
+    strlcpy(s->r.reply, reply.c_str(), sizeof(s->r.reply));
+    portEXIT_CRITICAL(&resultsMux);
+}
+
+static void workerFn(void*) {
+    for (;;) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        OutJob* j;
+        while ((j = jobs.consumerSlot())) {
+            unsigned long t0 = millis();
+            HTTPClient http;
+            http.setTimeout(OUTBOUND_TIMEOUT_MS);
+            http.begin(j->url);
+            http.addHeader("Content-Type", "application/json");
+            int code = http.POST((uint8_t*)j->body, j->len);
+            String reply = code > 0 ? http.getString() : HTTPClient::errorToString(code);
+            http.end();
+            free(j->body);
+
+            setResult(j->id, code >= 200 && code < 300 ? Outbound::State::Done : Outbound::State::Failed, code, reply);
+            Serial.printf("[Outbound] #%u %s -> %d in %lu ms\n", (unsigned)j->id, j->url, code, millis() - t0);
+            jobs.release();
+        }
+    }
+}
+
+void Outbound::begin() {
+    if (worker) return;
+    xTaskCreatePinnedToCore(workerFn, "outbound", 8192, nullptr, 1, &worker, OUTBOUND_CORE);
+}
+
+uint32_t Outbound::post(const char* path, const char* body, size_t len) {
+    OutJob* j = jobs.producerSlot();
+    if (!j || !worker || len > OUTBOUND_BODY_MAX) return 0;
+    if (!Endpoint::url(j->url, sizeof(j->url), path)) return 0;
+    char* copy = (char*)heap_caps_malloc(len ? len : 1, MALLOC_CAP_SPIRAM);
+    if (!copy) copy = (char*)malloc(len ? len : 1);
+    if (!copy) return 0;
+    memcpy(copy, body, len);
+    if (++nextId == 0) ++nextId;
+    j->id = nextId;
+    j->body = copy;
+    j->len = len;
+    setResult(j->id, State::Pending, 0, "");
+    jobs.publish();
+    xTaskNotifyGive(worker);
+    return j->id;
+}
+
+Outbound::State Outbound::result(uint32_t id, Result& out) {
+    OutResult* s = slotFor(id);
+    portENTER_CRITICAL(&resultsMux);
+    bool found = id && s->id == id;
+    if (found) out = s->r;
+    portEXIT_CRITICAL(&resultsMux);
+    if (!found) out.state = State::Unknown;
+    return out.state;
+}
@@ -0,0 +1,34 @@
+// outbound.h
+#pragma once
+
+#include <Arduino.h>
+
+// Background worker for HTTP requests to the LoveByte server, so web
+// handlers on the AsyncTCP task never wait on the network. Jobs are handed
+// over through a lock-free ring; results are kept for polling by job id.
+
+#define OUTBOUND_QUEUE      4       // jobs waiting for the worker
+#define OUTBOUND_RESULTS    8       // finished jobs remembered for polling
+#define OUTBOUND_REPLY_MAX  512     // server reply bytes kept per job
+#define OUTBOUND_BODY_MAX   4096
+#define OUTBOUND_TIMEOUT_MS 5000
+#define OUTBOUND_CORE       0
+
+namespace Outbound {
+    enum class State : uint8_t { Unknown, Pending, Done, Failed };
+
+    struct Result {
+        State state;
+        int code;                       // HTTP status, or HTTPClient error (< 0)
+        char reply[OUTBOUND_REPLY_MAX];
+    };
+
+    void begin();
+
+    // Queue a JSON POST of body (copied) to <server base><path>. Returns the
+    // job id, or 0 if the queue is full or no server is set. Producer: the AsyncTCP task only.
+    uint32_t post(const char* path, const char* body, size_t len);
+
+    // Copy a job's status into out. Unknown once it has dropped off the list.
+    State result(uint32_t id, Result& out);
+}
@@ -0,0 +1,223 @@
+#include "psram_pool.h"
+#include <esp_heap_caps.h>
+
+// Free blocks form one doubly linked list per order, stored in the blocks
+// themselves. meta[] holds one byte per minimum block: for the first block
+// of every allocated or free block, its order plus FREE/USED flags, so the
+// buddy's state is an array lookup.
+
+#define META_FREE   0x80
+#define META_USED   0x40
+#define META_ORDER  0x3F
+
+struct FreeNode {
+    FreeNode* prev;
+    FreeNode* next;
+};
+
+// Allocated blocks don't keep a header; the requested size is in a side
+// table so stats can show internal fragmentation
+static uint8_t* arena = nullptr;
+static uint8_t arenaOrder = 0;
+static uint8_t* meta = nullptr;
+static uint32_t* reqSize = nullptr;
+static FreeNode* freeLists[PSRAM_POOL_ORDERS];
+static portMUX_TYPE mux = portMUX_INITIALIZER_UNLOCKED;
+static PsramPool::Stats st = {};
+
+static inline size_t blockSize(uint8_t order) { return (size_t)PSRAM_POOL_MIN_BLOCK << order; }
+static inline uint32_t indexOf(void* p) { return ((uint8_t*)p - arena) / PSRAM_POOL_MIN_BLOCK; }
+
+static void pushFree(uint8_t* p, uint8_t order) {
+    FreeNode* n = (FreeNode*)p;
+    n->prev = nullptr;
+    n->next = freeLists[order];
+    if (n->next) n->next->prev = n;
+    freeLists[order] = n;
+    meta[indexOf(p)] = META_FREE | order;
+    st.freeBlocks[order]++;
+}
+
+static void unlinkFree(uint8_t* p, uint8_t order) {
+    FreeNode* n = (FreeNode*)p;
+    if (n->prev) n->prev->next = n->next;
+    else freeLists[order] = n->next;
+    if (n->next) n->next->prev = n->prev;
+    meta[indexOf(p)] = 0;
+    st.freeBlocks[order]--;
+}
+
+static void updateLargest() {
+    st.largestFree = 0;
+    for (int o = arenaOrder; o >= 0; --o) {
+        if (freeLists[o]) { st.largestFree = blockSize(o); break; }
+    }
+}
+
+static int orderFor(size_t bytes) {
+    uint8_t o = 0;
+    while (o <= arenaOrder && blockSize(o) < bytes) ++o;
+    return o <= arenaOrder ? o : -1;
+}
+
+void PsramPool::begin() {
+    if (arena) return;
+    size_t avail = heap_caps_get_largest_free_block(MALLOC_CAP_SPIRAM);
+    // Leave at least half of PSRAM to everything else
+    size_t limit = heap_caps_get_free_size(MALLOC_CAP_SPIRAM) / 2;
+    if (avail > limit) avail = limit;
+    int order = PSRAM_POOL_MAX_ORDER;
+    while (order >= 0 && blockSize(order) > avail) --order;
+    if (order < 0) {
+        Serial.println("[Pool] No PSRAM for the pool; using the heap");
+        return;
+    }
+    size_t blocks = (size_t)1 << order;
+    arena = (uint8_t*)heap_caps_aligned_alloc(PSRAM_POOL_MIN_BLOCK, blockSize(order), MALLOC_CAP_SPIRAM);
+    meta = (uint8_t*)heap_caps_calloc(blocks, 1, MALLOC_CAP_SPIRAM);
+    reqSize = (uint32_t*)heap_caps_calloc(blocks, sizeof(uint32_t), MALLOC_CAP_SPIRAM);
+    if (!arena || !meta || !reqSize) {
+        heap_caps_free(arena); heap_caps_free(meta); heap_caps_free(reqSize);
+        arena = nullptr;
+        Serial.println("[Pool] Arena allocation failed; using the heap");
+        return;
+    }
+    arenaOrder = order;
+    st.arenaBytes = blockSize(order);
+    pushFree(arena, order);
+    updateLargest();
+    Serial.printf("[Pool] %u KB arena, %u KB blocks and up\n",
+        (unsigned)(st.arenaBytes / 1024), (unsigned)(PSRAM_POOL_MIN_BLOCK / 1024));
+}
+
+static void* fallback(size_t bytes) {
+    void* p = heap_caps_malloc(bytes, MALLOC_CAP_SPIRAM);
+    if (!p) p = malloc(bytes);
+    portENTER_CRITICAL(&mux);
+    st.fallbacks++;
+    portEXIT_CRITICAL(&mux);
+    return p;
+}
+
+void* PsramPool::alloc(size_t bytes) {
+    if (!bytes) bytes = 1;
+    int want = arena ? orderFor(bytes) : -1;
+    if (want < 0) return fallback(bytes);
+
+    portENTER_CRITICAL(&mux);
+    int o = want;
+    while (o <= arenaOrder && !freeLists[o]) ++o;
+    if (o > arenaOrder) {
+        portEXIT_CRITICAL(&mux);
+        return fallback(bytes);
+    }
+    uint8_t* p = (uint8_t*)freeLists[o];
+    unlinkFree(p, o);
+    // Split down, returning the upper halves to their lists
+    while (o > want) {
+        --o;
+        pushFree(p + blockSize(o), o);
+    }
+    meta[indexOf(p)] = META_USED | want;
+    reqSize[indexOf(p)] = bytes;
+    st.usedBytes += blockSize(want);
+    st.requestedBytes += bytes;
+    if (st.usedBytes > st.highWater) st.highWater = st.usedBytes;
+    st.allocs++;
+    updateLargest();
+    portEXIT_CRITICAL(&mux);
+    return p;
+}
+
+static bool inArena(void* p) {
+    return arena && (uint8_t*)p >= arena && (uint8_t*)p < arena + blockSize(arenaOrder);
+}
+
+void PsramPool::free(void* ptr) {
+    if (!ptr) return;
+    if (!inArena(ptr)) {
+        heap_caps_free(ptr);
+        return;
+    }
+    portENTER_CRITICAL(&mux);
+    uint8_t* p = (uint8_t*)ptr;
+    uint32_t idx = indexOf(p);
+    uint8_t m = meta[idx];
+    if (!(m & META_USED) || (p - arena) % PSRAM_POOL_MIN_BLOCK) {   // double free or a pointer into a block
+        portEXIT_CRITICAL(&mux);
+        Serial.println("[Pool] Bad free ignored");
+        return;
+    }
+    uint8_t o = m & META_ORDER;
+    st.usedBytes -= blockSize(o);
+    st.requestedBytes -= reqSize[idx];
+    st.frees++;
+    // Merge with the buddy while it is free and whole
+    while (o < arenaOrder) {
+        uint8_t* buddy = arena + (((size_t)(p - arena)) ^ blockSize(o));
+        if (meta[indexOf(buddy)] != (META_FREE | o)) break;
+        unlinkFree(buddy, o);
+        if (buddy < p) p = buddy;
+        ++o;
+    }
+    meta[idx] = 0;
+    pushFree(p, o);
+    updateLargest();
+    portEXIT_CRITICAL(&mux);
+}
+
+void* PsramPool::realloc(void* ptr, size_t bytes) {
+    if (!ptr) return alloc(bytes);
+    size_t old;
+    if (inArena(ptr)) {
+        portENTER_CRITICAL(&mux);
+        uint32_t idx = indexOf(ptr);
+        old = blockSize(meta[idx] & META_ORDER);
+        if (bytes <= old) {     // still fits its block
+            st.requestedBytes += bytes;
+            st.requestedBytes -= reqSize[idx];
+            reqSize[idx] = bytes;
+            portEXIT_CRITICAL(&mux);
+            return ptr;
+        }
+        old = reqSize[idx];
+        portEXIT_CRITICAL(&mux);
+    } else {
+        old = heap_caps_get_allocated_size(ptr);
+    }
+    void* p = alloc(bytes);
+    if (!p) return nullptr;
+    memcpy(p, ptr, old < bytes ? old : bytes);
+    free(ptr);
+    return p;
+}
+
+PsramPool::Stats PsramPool::stats() {
+    portENTER_CRITICAL(&mux);
+    Stats s = st;
+    portEXIT_CRITICAL(&mux);
+    return s;
+}
+
+void PsramPool::write(Print& out) {
+    Stats s = stats();
+    uint32_t freeBytes = s.arenaBytes - s.usedBytes;
+    // External: free space not usable as one block. Internal: rounding loss.
+    float ext = freeBytes ? 1.0f - (float)s.largestFree / freeBytes : 0.0f;
+    float in = s.usedBytes ? 1.0f - (float)s.requestedBytes / s.usedBytes : 0.0f;
+    out.printf("# TYPE lovebyte_pool_arena_bytes gauge\nlovebyte_pool_arena_bytes %u\n", (unsigned)s.arenaBytes);
+    out.printf("# TYPE lovebyte_pool_used_bytes gauge\nlovebyte_pool_used_bytes %u\n", (unsigned)s.usedBytes);
+    out.printf("# TYPE lovebyte_pool_requested_bytes gauge\nlovebyte_pool_requested_bytes %u\n", (unsigned)s.requestedBytes);
+    out.printf("# TYPE lovebyte_pool_high_water_bytes gauge\nlovebyte_pool_high_water_bytes %u\n", (unsigned)s.highWater);
+    out.printf("# TYPE lovebyte_pool_largest_free_bytes gauge\nlovebyte_pool_largest_free_bytes %u\n", (unsigned)s.largestFree);
+    out.printf("# TYPE lovebyte_pool_fragmentation_ratio gauge\n"
+        "lovebyte_pool_fragmentation_ratio{kind=\"external\"} %.3f\n"
+        "lovebyte_pool_fragmentation_ratio{kind=\"internal\"} %.3f\n", ext, in);
+    out.printf("# TYPE lovebyte_pool_free_blocks gauge\n");
+    for (int o = 0; o <= arenaOrder && s.arenaBytes; ++o) {
+        out.printf("lovebyte_pool_free_blocks{size=\"%u\"} %u\n", (unsigned)blockSize(o), (unsigned)s.freeBlocks[o]);
+    }
+    out.printf("# TYPE lovebyte_pool_allocs_total counter\nlovebyte_pool_allocs_total %u\n", (unsigned)s.allocs);
+    out.printf("# TYPE lovebyte_pool_frees_total counter\nlovebyte_pool_frees_total %u\n", (unsigned)s.frees);
+    out.printf("# TYPE lovebyte_pool_fallbacks_total counter\nlovebyte_pool_fallbacks_total %u\n", (unsigned)s.fallbacks);
+}
@@ -0,0 +1,51 @@
+// psram_pool.h
+#pragma once
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+
+// Buddy allocator over one PSRAM arena reserved at boot, for the big
+// short-lived buffers (image files, GIF data, scaler work areas, JSON
+// documents). Blocks come in power-of-two size classes from
+// PSRAM_POOL_MIN_BLOCK up; a freed block merges with its free buddy, so
+// the arena can't splinter into pieces too small for the next GIF the way
+// the general heap does. Requests the arena can't serve fall back to the
+// heap and are counted.
+
+#define PSRAM_POOL_MIN_BLOCK  4096
+#define PSRAM_POOL_MAX_ORDER  10                    // arena = 4 KB << 10 = 4 MB
+#define PSRAM_POOL_ORDERS     (PSRAM_POOL_MAX_ORDER + 1)
+
+namespace PsramPool {
+    struct Stats {
+        uint32_t arenaBytes;
+        uint32_t usedBytes;         // block sizes handed out
+        uint32_t requestedBytes;    // what callers asked for
+        uint32_t highWater;         // peak usedBytes
+        uint32_t largestFree;       // biggest block allocatable right now
+        uint32_t allocs, frees;
+        uint32_t fallbacks;         // served by the heap instead
+        uint16_t freeBlocks[PSRAM_POOL_ORDERS];
+    };
+
+    // Reserve the arena (as large as PSRAM allows, up to the max order)
+    void begin();
+
+    void* alloc(size_t bytes);
+    void free(void* p);             // pool or fallback pointer, or nullptr
+    void* realloc(void* p, size_t bytes);
+
+    Stats stats();
+
+    // Prometheus gauges for /metrics
+    void write(Print& out);
+
+    // ArduinoJson allocator: documents live in the pool
+    struct JsonAllocator {
+        void* allocate(size_t n) { return PsramPool::alloc(n); }
+        void deallocate(void* p) { PsramPool::free(p); }
+        void* reallocate(void* p, size_t n) { return PsramPool::realloc(p, n); }
+    };
+}
+
+typedef BasicJsonDocument<PsramPool::JsonAllocator> PoolJsonDocument;
@@ -0,0 +1,117 @@
+#include "render_pipe.h"
+#include "settings.h"
+#include "spsc.h"
+#include <atomic>
+
+struct RenderTile {
+    int16_t x, y, w, h;
+    uint16_t px[RENDER_TILE_PX];
+};
+
+// Lives in internal RAM so the panel DMA can read the tiles directly
+static SpscRing<RenderTile, RENDER_SLOTS> ring;
+
+static TaskHandle_t renderTask = nullptr;
+static volatile TaskHandle_t producerWaiting = nullptr;
+// Set while the render task holds the panel transaction. The ring empties
+// before endWrite(), so flush() waits on this rather than on the ring.
+static std::atomic<bool> rendering{false};
+
+static uint32_t statTiles = 0;
+static uint32_t statPixels = 0;
+static uint32_t statStallUs = 0;
+
+#if RENDER_PIPELINE
+// Consumer: drain the ring, keeping the bus open while tiles keep coming
+static void renderTaskFn(void*) {
+    for (;;) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        RenderTile* t = ring.consumerSlot();
+        if (!t) continue;
+
+        rendering.store(true, std::memory_order_release);
+        ::display.startWrite();
+        while (t) {
+            ::display.pushImageDMA(t->x, t->y, t->w, t->h, t->px);
+            ::display.waitDMA();           // slot must not be reused mid-transfer
+            statTiles++;
+            statPixels += (uint32_t)t->w * t->h;
+            ring.release();
+            TaskHandle_t w = producerWaiting;
+            if (w) xTaskNotifyGive(w);
+            t = ring.consumerSlot();
+        }
+        ::display.endWrite();
+        rendering.store(false, std::memory_order_release);
+        TaskHandle_t w = producerWaiting;
+        if (w) xTaskNotifyGive(w);
+    }
+}
+
+// Producer: sleep until the render task frees a slot (or times out and re-checks)
+static void waitForConsumer() {
+    unsigned long t0 = micros();
+    producerWaiting = xTaskGetCurrentTaskHandle();
+    ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(2));
+    producerWaiting = nullptr;
+    statStallUs += micros() - t0;
+}
+#endif
+
+void RenderPipe::begin() {
+#if RENDER_PIPELINE
+    if (renderTask) return;
+    xTaskCreatePinnedToCore(renderTaskFn, "render", 4096, nullptr, 3, &renderTask, RENDER_CORE);
+#endif
+}
+
+#if RENDER_PIPELINE
+uint16_t* RenderPipe::acquire(int16_t x, int16_t y, int16_t w, int16_t h) {
+    RenderTile* t;
+    while (!(t = ring.producerSlot())) waitForConsumer();
+    t->x = x; t->y = y; t->w = w; t->h = h;
+    return t->px;
+}
+
+void RenderPipe::submit() {
+    ring.publish();
+    xTaskNotifyGive(renderTask);
+}
+
+void RenderPipe::flush() {
+    while (!ring.empty() || rendering.load(std::memory_order_acquire)) waitForConsumer();
+}
+#else
+static RenderTile direct;
+
+uint16_t* RenderPipe::acquire(int16_t x, int16_t y, int16_t w, int16_t h) {
+    direct.x = x; direct.y = y; direct.w = w; direct.h = h;
+    return direct.px;
+}
+
+void RenderPipe::submit() {
+    ::display.pushImage(direct.x, direct.y, direct.w, direct.h, direct.px);
+    statTiles++;
+    statPixels += (uint32_t)direct.w * direct.h;
+}
+
+void RenderPipe::flush() {}
+#endif
+
+void RenderPipe::pushRect(int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t* px) {
+    if (w <= 0 || h <= 0 || w > RENDER_TILE_PX) return;
+    int16_t rowsPerTile = RENDER_TILE_PX / w;
+    while (h > 0) {
+        int16_t rows = h < rowsPerTile ? h : rowsPerTile;
+        uint16_t* dst = acquire(x, y, w, rows);
+        memcpy(dst, px, (size_t)w * rows * sizeof(uint16_t));
+        submit();
+        px += (size_t)w * rows;
+        y += rows;
+        h -= rows;
+    }
+}
+
+uint32_t RenderPipe::tiles() { return statTiles; }
+uint32_t RenderPipe::pixels() { return statPixels; }
+uint32_t RenderPipe::stallUs() { return statStallUs; }
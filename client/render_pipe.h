@@ -0,0 +1,40 @@
+// render_pipe.h
+#pragma once
+
+#include <Arduino.h>
+
+// Producer/consumer pipeline between the image decoders (Arduino loop core)
+// and the panel. Decoders fill tiles from a small ring; a render task pinned
+// to the other core pushes them to the panel with DMA while the next tile is
+// decoded.
+
+// Set to 0 to push tiles synchronously on the caller (for A/B timing)
+#ifndef RENDER_PIPELINE
+#define RENDER_PIPELINE 1
+#endif
+
+#define RENDER_TILE_PX   2048   // pixels per tile (JPEGDEC MCU block / GIF line)
+#define RENDER_SLOTS     4
+#define RENDER_CORE      0      // Arduino loop() runs on core 1
+
+namespace RenderPipe {
+    // Start the render task. Call once after display.init().
+    void begin();
+
+    // Producer: get a tile buffer for w*h (<= RENDER_TILE_PX) RGB565 big-endian
+    // pixels at (x, y). Blocks while the ring is full.
+    uint16_t* acquire(int16_t x, int16_t y, int16_t w, int16_t h);
+    void submit();
+
+    // Copy an arbitrary rectangle in, split across as many tiles as needed.
+    void pushRect(int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t* px);
+
+    // Wait until every submitted tile is on the panel. Call before drawing
+    // to the display directly.
+    void flush();
+
+    // Totals since boot (tiles and pixels pushed, µs the producer spent waiting)
+    uint32_t tiles();
+    uint32_t pixels();
+    uint32_t stallUs();
+}
@@ -0,0 +1,128 @@
+#include "sd_bench.h"
+#include "sd_writer.h"
+#include <SD_MMC.h>
+#include <esp_heap_caps.h>
+#include <atomic>
+
+enum class State : uint8_t { Idle, Pending, Running, Done, Failed };
+
+struct BenchResult {
+    const char* name;
+    uint32_t kbps;
+};
+
+#define BENCH_TESTS 6
+
+static std::atomic<State> state{State::Idle};
+static uint32_t benchKb = SD_BENCH_DEFAULT_KB;
+static BenchResult results[BENCH_TESTS];
+static uint8_t resultCount = 0;
+
+static void addResult(const char* name, size_t bytes, unsigned long us) {
+    if (resultCount >= BENCH_TESTS) return;
+    results[resultCount++] = { name, (uint32_t)(us ? (uint64_t)bytes * 1000000 / 1024 / us : 0) };
+    Serial.printf("[SdBench] %-18s %6lu KB/s\n", name, (unsigned long)results[resultCount - 1].kbps);
+}
+
+static const char* const BENCH_PATH = SD_MOUNT SD_BENCH_FILE;
+
+static bool run(uint8_t* buf) {
+    const size_t bytes = (size_t)benchKb * 1024;
+    unsigned long t0;
+
+    // Old download path: File writes in 2 KB pieces
+    File f = SD_MMC.open(SD_BENCH_FILE, FILE_WRITE);
+    if (!f) return false;
+    memset(buf, 0x5A, SD_WRITER_DEFAULT);
+    t0 = micros();
+    for (size_t done = 0; done < bytes; done += 2048) f.write(buf, 2048);
+    f.close();
+    addResult("write_file_2k", bytes, micros() - t0);
+    SD_MMC.remove(SD_BENCH_FILE);
+
+    // New path: SdWriter with preallocation, still fed 2 KB at a time
+    {
+        SdWriter w;
+        t0 = micros();
+        if (!w.open(SD_BENCH_FILE, bytes)) return false;
+        for (size_t done = 0; done < bytes; done += 2048) w.write(buf, 2048);
+        bool pre = w.preallocated();
+        if (!w.close()) return false;
+        // Name the row after what actually ran, in case the seek-out failed
+        addResult(pre ? "write_sdwriter_prealloc" : "write_sdwriter", bytes, micros() - t0);
+    }
+
+    // Sequential reads: File in 2 KB pieces, then fread of whole buffers
+    f = SD_MMC.open(SD_BENCH_FILE, FILE_READ);
+    if (!f) return false;
+    t0 = micros();
+    while (f.read(buf, 2048) == 2048) {}
+    f.close();
+    addResult("read_file_2k", bytes, micros() - t0);
+
+    FILE* raw = fopen(BENCH_PATH, "rb");
+    if (!raw) return false;
+    setvbuf(raw, nullptr, _IONBF, 0);
+    t0 = micros();
+    while (fread(buf, 1, SD_WRITER_DEFAULT, raw) == SD_WRITER_DEFAULT) {}
+    addResult("read_raw_16k", bytes, micros() - t0);
+
+    // Random 4 KB reads and in-place writes at 4 KB-aligned offsets
+    const uint32_t blocks = bytes / 4096;
+    uint32_t seed = esp_random();
+    t0 = micros();
+    for (int i = 0; i < SD_BENCH_RANDOM_OPS; ++i) {
+        seed = seed * 1664525 + 1013904223;
+        fseek(raw, (long)(seed % blocks) * 4096, SEEK_SET);
+        fread(buf, 1, 4096, raw);
+    }
+    addResult("read_random_4k", SD_BENCH_RANDOM_OPS * 4096, micros() - t0);
+    fclose(raw);
+
+    raw = fopen(BENCH_PATH, "r+b");
+    if (!raw) return false;
+    setvbuf(raw, nullptr, _IONBF, 0);
+    t0 = micros();
+    for (int i = 0; i < SD_BENCH_RANDOM_OPS; ++i) {
+        seed = seed * 1664525 + 1013904223;
+        fseek(raw, (long)(seed % blocks) * 4096, SEEK_SET);
+        fwrite(buf, 1, 4096, raw);
+    }
+    fclose(raw);
+    addResult("write_random_4k", SD_BENCH_RANDOM_OPS * 4096, micros() - t0);
+    return true;
+}
+
+bool SdBench::request(uint32_t kb) {
+    State expect = state.load();
+    if (expect == State::Pending || expect == State::Running) return false;
+    if (kb < 64) kb = 64;
+    if (kb > SD_BENCH_MAX_KB) kb = SD_BENCH_MAX_KB;
+    // Whole 16 KB buffers, so every loop in run() (2, 4 and 16 KB steps) covers
+    // exactly the file
+    benchKb = kb - kb % (SD_WRITER_DEFAULT / 1024);
+    return state.compare_exchange_strong(expect, State::Pending);
+}
+
+void SdBench::loop() {
+    if (state.load() != State::Pending) return;
+    state = State::Running;
+    resultCount = 0;
+    uint8_t* buf = (uint8_t*)heap_caps_aligned_alloc(4, SD_WRITER_DEFAULT, MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL);
+    bool ok = buf && run(buf);
+    if (buf) heap_caps_free(buf);
+    SD_MMC.remove(SD_BENCH_FILE);
+    state = ok ? State::Done : State::Failed;
+}
+
+void SdBench::writeJson(Print& out) {
+    static const char* const NAMES[] = { "idle", "pending", "running", "done", "failed" };
+    State s = state.load();
+    out.printf("{\"state\":\"%s\",\"kb\":%u,\"results\":[", NAMES[(int)s], (unsigned)benchKb);
+    // Results are only stable once the run has finished
+    uint8_t n = (s == State::Done || s == State::Failed) ? resultCount : 0;
+    for (uint8_t i = 0; i < n; ++i) {
+        out.printf("%s{\"name\":\"%s\",\"kbps\":%u}", i ? "," : "", results[i].name, (unsigned)results[i].kbps);
+    }
+    out.print("]}");
+}
@@ -0,0 +1,25 @@
+// sd_bench.h
+#pragma once
+
+#include <Arduino.h>
+
+// On-demand SD throughput check for the diagnostics page. The old paths
+// (File writes/reads in 2 KB pieces, as network data used to arrive) are
+// timed next to the SdWriter and plain fread() of whole buffers, plus
+// random 4 KB reads and writes. Runs from loop(), so the screen and pulls
+// pause for the few seconds it takes.
+
+#define SD_BENCH_FILE       "/.sdbench.tmp"
+#define SD_BENCH_DEFAULT_KB 2048
+#define SD_BENCH_MAX_KB     16384
+#define SD_BENCH_RANDOM_OPS 256
+
+namespace SdBench {
+    // Queue a run over a file of kb KB (clamped, rounded down to 16 KB);
+    // false if one is pending or running
+    bool request(uint32_t kb);
+    void loop();
+
+    // {"state":"idle|pending|running|done|failed","kb":N,"results":[{"name","kbps"},...]}
+    void writeJson(Print& out);
+}
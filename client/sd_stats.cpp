@@ -0,0 +1,101 @@
+#include "sd_stats.h"
+#include <SD_MMC.h>
+
+static portMUX_TYPE mux = portMUX_INITIALIZER_UNLOCKED;
+static SdStats::Snapshot stats = {};
+static uint32_t scannedAt = 0;
+static uint32_t changedAt = 0;
+static bool dirty = false;
+static SdStats::RootEntry rootList[SD_STATS_ROOT_MAX];
+static uint8_t rootCount = 0;
+
+static void changed(int64_t delta) {
+    portENTER_CRITICAL(&mux);
+    if (stats.present) {
+        int64_t used = (int64_t)stats.used + delta;
+        stats.used = used < 0 ? 0 : (uint64_t)used;
+        stats.exact = false;
+        dirty = true;
+        changedAt = millis();
+    }
+    portEXIT_CRITICAL(&mux);
+}
+
+// Loop task only: the slow part, done outside the lock
+static void rescan() {
+    unsigned long t0 = millis();
+    uint64_t used = SD_MMC.usedBytes();
+
+    SdStats::RootEntry list[SD_STATS_ROOT_MAX];
+    uint8_t n = 0;
+    File root = SD_MMC.open("/");
+    File f;
+    while (root && n < SD_STATS_ROOT_MAX && (f = root.openNextFile())) {
+        const char* name = f.name();
+        const char* slash = strrchr(name, '/');
+        strlcpy(list[n].name, slash ? slash + 1 : name, SD_STATS_NAME_MAX);
+        list[n].dir = f.isDirectory();
+        list[n].size = list[n].dir ? 0 : f.size();
+        ++n;
+        f.close();
+    }
+    if (root) root.close();
+
+    portENTER_CRITICAL(&mux);
+    stats.used = used;
+    // A write that landed mid-scan keeps the flag set for another pass
+    stats.exact = !dirty;
+    scannedAt = millis();
+    memcpy(rootList, list, n * sizeof(list[0]));
+    rootCount = n;
+    portEXIT_CRITICAL(&mux);
+    Serial.printf("[SdStats] %llu of %llu bytes used, scanned in %lu ms\n",
+        (unsigned long long)used, (unsigned long long)stats.total, millis() - t0);
+}
+
+void SdStats::begin() {
+    portENTER_CRITICAL(&mux);
+    stats.present = true;
+    stats.cardSize = SD_MMC.cardSize();
+    stats.total = SD_MMC.totalBytes();
+    dirty = true;
+    changedAt = millis() - SD_STATS_SETTLE_MS;  // first scan right away
+    portEXIT_CRITICAL(&mux);
+}
+
+void SdStats::loop() {
+    portENTER_CRITICAL(&mux);
+    bool due = dirty && millis() - changedAt >= SD_STATS_SETTLE_MS;
+    if (due) dirty = false;
+    portEXIT_CRITICAL(&mux);
+    if (due) rescan();
+}
+
+void SdStats::added(uint32_t bytes) {
+    changed(bytes);
+}
+
+bool SdStats::remove(const String& path) {
+    File f = SD_MMC.open(path, FILE_READ);
+    uint32_t size = (f && !f.isDirectory()) ? f.size() : 0;
+    if (f) f.close();
+    bool ok = SD_MMC.remove(path);
+    if (ok) changed(-(int64_t)size);
+    return ok;
+}
+
+SdStats::Snapshot SdStats::get() {
+    portENTER_CRITICAL(&mux);
+    Snapshot s = stats;
+    s.ageMs = scannedAt ? millis() - scannedAt : 0;
+    portEXIT_CRITICAL(&mux);
+    return s;
+}
+
+uint8_t SdStats::root(RootEntry* out, uint8_t max) {
+    portENTER_CRITICAL(&mux);
+    uint8_t n = rootCount < max ? rootCount : max;
+    memcpy(out, rootList, n * sizeof(RootEntry));
+    portEXIT_CRITICAL(&mux);
+    return n;
+}
@@ -0,0 +1,42 @@
+// sd_stats.h
+#pragma once
+
+#include <Arduino.h>
+
+// SD card usage for the diagnostics page without touching the card from a
+// web handler. Writes and deletes adjust a running "used" figure as they
+// happen; loop() does the slow exact count (a FAT free-cluster scan) and the
+// root listing only once things have been quiet for SD_STATS_SETTLE_MS.
+
+#define SD_STATS_SETTLE_MS  30000
+#define SD_STATS_ROOT_MAX   32
+#define SD_STATS_NAME_MAX   48
+
+namespace SdStats {
+    struct Snapshot {
+        bool present;
+        bool exact;         // false while a change is waiting for its rescan
+        uint64_t cardSize;
+        uint64_t total;
+        uint64_t used;
+        uint32_t ageMs;     // since the last exact scan
+    };
+
+    struct RootEntry {
+        char name[SD_STATS_NAME_MAX];
+        bool dir;
+        uint32_t size;
+    };
+
+    void begin();   // after a successful SD_MMC.begin()
+    void loop();    // call from loop(): runs a pending rescan once settled
+
+    // Account for a file written (any task)
+    void added(uint32_t bytes);
+
+    // SD_MMC.remove() that also accounts for the freed bytes
+    bool remove(const String& path);
+
+    Snapshot get();
+    uint8_t root(RootEntry* out, uint8_t max);
+}
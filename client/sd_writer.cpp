@@ -0,0 +1,84 @@
+#include "sd_writer.h"
+#include "metrics.h"
+#include <esp_heap_caps.h>
+#include <unistd.h>
+#include <sys/stat.h>
+
+SdWriter::SdWriter(size_t bufSize) {
+    size_t size = (bufSize + SD_SECTOR - 1) & ~(size_t)(SD_SECTOR - 1);
+    if (size < SD_WRITER_MIN) size = SD_WRITER_MIN;
+    if (size > SD_WRITER_MAX) size = SD_WRITER_MAX;
+    for (; size >= SD_WRITER_MIN && !buf; size /= 2) {
+        buf = (uint8_t*)heap_caps_aligned_alloc(4, size, MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL);
+        if (buf) cap = size;
+    }
+}
+
+SdWriter::~SdWriter() {
+    if (f) close();
+    if (buf) heap_caps_free(buf);
+}
+
+bool SdWriter::open(const char* path, size_t expected) {
+    if (!buf || f) return false;
+    char full[160];
+    snprintf(full, sizeof(full), SD_MOUNT "%s", path);
+    f = fopen(full, "wb");
+    if (!f) return false;
+    // We hand over whole buffers; newlib's own small buffer would only split them
+    setvbuf(f, nullptr, _IONBF, 0);
+    fill = total = reserved = 0;
+    failed = false;
+    // The FAT VFS refuses to grow a file with ftruncate(), but FatFs's
+    // f_lseek() past the end of a file open for writing allocates the
+    // clusters up to there; seek back and confirm the size took
+    if (expected) {
+        int fd = fileno(f);
+        struct stat st;
+        if (lseek(fd, expected, SEEK_SET) == (off_t)expected && lseek(fd, 0, SEEK_SET) == 0 &&
+            fstat(fd, &st) == 0 && (size_t)st.st_size >= expected) {
+            reserved = expected;
+        } else {
+            lseek(fd, 0, SEEK_SET);
+        }
+    }
+    return true;
+}
+
+bool SdWriter::flush() {
+    if (!fill || failed) return !failed;
+    unsigned long t0 = micros();
+    size_t n = fwrite(buf, 1, fill, f);
+    Metrics::observe(Metrics::Hist::SdWriteUs, micros() - t0);
+    if (n != fill) failed = true;
+    fill = 0;
+    return !failed;
+}
+
+size_t SdWriter::write(uint8_t c) {
+    return write(&c, 1);
+}
+
+size_t SdWriter::write(const uint8_t* data, size_t len) {
+    if (!f || failed) return 0;
+    size_t left = len;
+    while (left) {
+        size_t n = cap - fill < left ? cap - fill : left;
+        memcpy(buf + fill, data, n);
+        fill += n;
+        data += n;
+        left -= n;
+        if (fill == cap && !flush()) return len - left;
+    }
+    total += len;
+    return len;
+}
+
+bool SdWriter::close() {
+    if (!f) return false;
+    flush();
+    if (reserved > total && ftruncate(fileno(f), total) != 0) failed = true;
+    if (fclose(f) != 0) failed = true;
+    f = nullptr;
+    return !failed;
+}
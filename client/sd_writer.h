@@ -0,0 +1,47 @@
+// sd_writer.h
+#pragma once
+
+#include <Arduino.h>
+#include <stdio.h>
+
+// Write-back writer for SD files. Bytes collect in a DMA-capable buffer and
+// reach the card only as whole buffers, so every write but the last is a
+// multiple of the sector size at a sector-aligned offset and goes to the
+// card without the driver's bounce copy. With a known final size the file
+// is seeked out to that size up front, so FatFs allocates all its clusters
+// in one pass instead of walking the FAT again for every buffer.
+
+#define SD_MOUNT            "/sd"
+#define SD_SECTOR           512
+#define SD_WRITER_MIN       (4 * 1024)
+#define SD_WRITER_MAX       (32 * 1024)
+#define SD_WRITER_DEFAULT   (16 * 1024)
+
+class SdWriter : public Print {
+public:
+    // bufSize is rounded to whole sectors and clamped to MIN..MAX; a smaller
+    // buffer is used if memory is short
+    explicit SdWriter(size_t bufSize = SD_WRITER_DEFAULT);
+    ~SdWriter();
+
+    // path is as for SD_MMC ("/images/a.jpg"); expected = 0 if unknown
+    bool open(const char* path, size_t expected = 0);
+    size_t write(uint8_t c) override;
+    size_t write(const uint8_t* data, size_t len) override;
+
+    // Flush, trim any preallocation past the data, close. False if any
+    // write failed along the way.
+    bool close();
+
+    size_t written() const { return total; }
+    bool preallocated() const { return reserved != 0; }
+    bool ok() const { return f && !failed; }
+
+private:
+    bool flush();
+
+    FILE* f = nullptr;
+    uint8_t* buf = nullptr;
+    size_t cap = 0, fill = 0, total = 0, reserved = 0;
+    bool failed = false;
+};
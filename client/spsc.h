@@ -0,0 +1,62 @@
+// spsc.h
+#pragma once
+
+#include <atomic>
+#include <stddef.h>
+#include <stdint.h>
+
+// Lock-free single-producer/single-consumer ring of N slots (N a power of 2).
+// Slots are used in place: the producer fills the slot returned by
+// producerSlot() and calls publish(); the consumer reads consumerSlot() and
+// calls release() when it is done with it. Exactly one task may produce and
+// exactly one may consume.
+template <typename T, size_t N>
+class SpscRing {
+    static_assert(N && (N & (N - 1)) == 0, "SpscRing size must be a power of 2");
+
+public:
+    // Producer side
+    T* producerSlot() {
+        uint32_t h = head.load(std::memory_order_relaxed);
+        if (h - tail.load(std::memory_order_acquire) == N) return nullptr;
+        return &slots[h & (N - 1)];
+    }
+    void publish() {
+        head.store(head.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    }
+    bool push(const T& v) {
+        T* s = producerSlot();
+        if (!s) return false;
+        *s = v;
+        publish();
+        return true;
+    }
+
+    // Consumer side
+    T* consumerSlot() {
+        uint32_t t = tail.load(std::memory_order_relaxed);
+        if (t == head.load(std::memory_order_acquire)) return nullptr;
+        return &slots[t & (N - 1)];
+    }
+    void release() {
+        tail.store(tail.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    }
+    bool pop(T& out) {
+        T* s = consumerSlot();
+        if (!s) return false;
+        out = *s;
+        release();
+        return true;
+    }
+
+    // Either side (approximate while the other side is running)
+    size_t size() const {
+        return head.load(std::memory_order_acquire) - tail.load(std::memory_order_acquire);
+    }
+    bool empty() const { return size() == 0; }
+
+private:
+    T slots[N];
+    std::atomic<uint32_t> head{0};
+    std::atomic<uint32_t> tail{0};
+};
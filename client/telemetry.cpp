@@ -0,0 +1,87 @@
+#include "telemetry.h"
+#include "led.h"
+#include <WiFi.h>
+#include <ArduinoJson.h>
+#include <esp_timer.h>
+
+struct Sample {
+    uint32_t heap, minHeap, psram, uptime, led;
+    int8_t rssi;
+    uint8_t bright;
+};
+
+static AsyncEventSource events("/api/events");
+static volatile bool sendFull = true;
+static volatile uint32_t intervalMs = TELEMETRY_MS_DEFAULT;
+static unsigned long lastTick = 0;
+static Sample last;
+static uint32_t eventId = 0;
+
+static void take(Sample& s) {
+    s.heap = ESP.getFreeHeap();
+    s.minHeap = ESP.getMinFreeHeap();
+    s.psram = ESP.getPsramSize() ? ESP.getFreePsram() : 0;
+    s.uptime = esp_timer_get_time() / 1000000ULL;
+    s.rssi = WiFi.isConnected() ? WiFi.RSSI() : 0;
+    s.led = Led::getOutput();
+    s.bright = Led::getBrightness();
+}
+
+void Telemetry::begin(AsyncWebServer& server) {
+    events.onConnect([](AsyncEventSourceClient* client) {
+        client->send("hello", nullptr, eventId, TELEMETRY_MS_MAX);  // also sets the retry delay
+        sendFull = true;
+    });
+    server.addHandler(&events);
+
+    server.on("/api/telemetry", HTTP_POST, [](AsyncWebServerRequest* request){}, NULL,
+        [](AsyncWebServerRequest* request, uint8_t* data, size_t len, size_t, size_t) {
+            StaticJsonDocument<64> doc;
+            if (deserializeJson(doc, data, len) || !doc["ms"].is<uint32_t>()) {
+                request->send(400, "text/plain", "Bad JSON");
+                return;
+            }
+            setInterval(doc["ms"]);
+            request->send(200, "application/json", "{\"ms\":" + String(interval()) + "}");
+        }
+    );
+}
+
+void Telemetry::setInterval(uint32_t ms) {
+    if (ms < TELEMETRY_MS_MIN) ms = TELEMETRY_MS_MIN;
+    if (ms > TELEMETRY_MS_MAX) ms = TELEMETRY_MS_MAX;
+    intervalMs = ms;
+}
+
+uint32_t Telemetry::interval() { return intervalMs; }
+
+void Telemetry::loop() {
+    unsigned long now = millis();
+    if (now - lastTick < intervalMs) return;
+    lastTick = now;
+    if (events.count() == 0) return;    // nobody listening: don't even sample
+
+    Sample s;
+    take(s);
+    bool full = sendFull;
+    sendFull = false;
+
+    // One sample and one serialised delta per tick, shared by every client
+    char msg[160];
+    int n = 1;
+    msg[0] = '{';
+#define FIELD(key, fmt, cur, prev) \
+    if (full || (cur) != (prev)) n += snprintf(msg + n, sizeof(msg) - n, "%s\"" key "\":" fmt, n > 1 ? "," : "", cur)
+    FIELD("h", "%u", (unsigned)s.heap, (unsigned)last.heap);
+    FIELD("m", "%u", (unsigned)s.minHeap, (unsigned)last.minHeap);
+    FIELD("p", "%u", (unsigned)s.psram, (unsigned)last.psram);
+    FIELD("r", "%d", (int)s.rssi, (int)last.rssi);
+    FIELD("u", "%u", (unsigned)s.uptime, (unsigned)last.uptime);
+    FIELD("l", "\"%06X\"", (unsigned)s.led, (unsigned)last.led);
+    FIELD("b", "%u", (unsigned)s.bright, (unsigned)last.bright);
+#undef FIELD
+    last = s;
+    if (n == 1) return;     // nothing changed
+    snprintf(msg + n, sizeof(msg) - n, "}");
+    events.send(msg, "t", ++eventId);
+}
@@ -0,0 +1,24 @@
+// telemetry.h
+#pragma once
+
+#include <ESPAsyncWebServer.h>
+
+// Live diagnostics over server-sent events at /api/events. loop() samples
+// once per interval, and only while a browser is listening; each event
+// carries just the fields that changed ("t" event, compact JSON keys):
+//   h free heap, m min free heap, p free PSRAM, r RSSI (0 = offline),
+//   u uptime s, l LED colour (RRGGBB hex), b LED brightness
+// A newly connected browser gets every field on the next tick.
+
+#define TELEMETRY_MS_DEFAULT  1000
+#define TELEMETRY_MS_MIN      100
+#define TELEMETRY_MS_MAX      10000
+
+namespace Telemetry {
+    // Registers /api/events and POST /api/telemetry {"ms":N} (sets the rate)
+    void begin(AsyncWebServer& server);
+    void loop();
+
+    void setInterval(uint32_t ms);
+    uint32_t interval();
+}
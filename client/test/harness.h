@@ -0,0 +1,43 @@
+// Minimal host test harness: TEST() registers a case, CHECK() records a
+// failure without stopping the case, TEST_MAIN() runs them all.
+#pragma once
+#include <cstdio>
+#include <vector>
+
+struct TestCase {
+    const char* name;
+    void (*fn)();
+};
+
+inline std::vector<TestCase>& testCases() {
+    static std::vector<TestCase> cases;
+    return cases;
+}
+inline int testFailures = 0;
+
+struct TestRegistrar {
+    TestRegistrar(const char* name, void (*fn)()) { testCases().push_back({ name, fn }); }
+};
+
+#define TEST(name)                                          \
+    static void name();                                     \
+    static TestRegistrar name##_reg(#name, name);           \
+    static void name()
+
+#define CHECK(cond) do {                                                    \
+        if (!(cond)) {                                                      \
+            if (++testFailures <= 20)                                       \
+                printf("    %s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #cond); \
+        }                                                                   \
+    } while (0)
+
+#define TEST_MAIN()                                                         \
+    int main() {                                                            \
+        for (const TestCase& t : testCases()) {                             \
+            int before = testFailures;                                      \
+            printf("%s\n", t.name);                                         \
+            t.fn();                                                         \
+            printf("  %s\n", testFailures == before ? "ok" : "FAILED");     \
+        }                                                                   \
+        return testFailures ? 1 : 0;                                        \
+    }
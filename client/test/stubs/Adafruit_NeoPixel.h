@@ -0,0 +1,9 @@
+// Host stand-in for Adafruit_NeoPixel: settings.h only constructs one
+#pragma once
+#include <Arduino.h>
+#define NEO_GRB     0
+#define NEO_KHZ800  0
+class Adafruit_NeoPixel {
+public:
+    Adafruit_NeoPixel(uint16_t, int16_t, int) {}
+};
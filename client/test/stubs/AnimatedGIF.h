@@ -0,0 +1,15 @@
+// Host stand-in for AnimatedGIF: only the per-line draw record the scaler reads
+#pragma once
+#include <Arduino.h>
+
+#define GIF_PALETTE_RGB565_BE 1
+
+struct GIFDRAW {
+    int iX, iY;             // frame rect on the canvas
+    int y;                  // line within the rect
+    int iWidth, iHeight;
+    uint8_t* pPixels;       // palette indices
+    uint16_t* pPalette;
+    uint8_t ucTransparent, ucHasTransparency, ucDisposalMethod, ucBackground;
+    void* pUser;
+};
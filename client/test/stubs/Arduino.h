@@ -0,0 +1,207 @@
+// Host stand-in for the ESP32 Arduino core: just enough of String, Print,
+// Serial, the clock and FreeRTOS locking for the sketch modules under test.
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cstdarg>
+#include <cmath>
+#include <string>
+#include <algorithm>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+// newlib has these; older glibc doesn't
+inline size_t hostStrlcpy(char* d, const char* s, size_t n) {
+    size_t len = strlen(s);
+    if (n) { size_t k = len < n - 1 ? len : n - 1; memcpy(d, s, k); d[k] = 0; }
+    return len;
+}
+#define strlcpy hostStrlcpy
+
+#define IRAM_ATTR
+#define PROGMEM
+#define RTC_NOINIT_ATTR
+
+// --- Clock: tests move it by hand ---
+inline uint64_t hostMicros = 0;
+inline unsigned long millis() { return (unsigned long)(hostMicros / 1000); }
+inline unsigned long micros() { return (unsigned long)hostMicros; }
+inline void delay(unsigned long ms) { hostMicros += (uint64_t)ms * 1000; }
+inline void hostAdvanceMs(unsigned long ms) { hostMicros += (uint64_t)ms * 1000; }
+
+// --- FreeRTOS critical sections: one lock for all, since a module that
+// starts a task (a real thread here) shares state with it ---
+typedef int portMUX_TYPE;
+#define portMUX_INITIALIZER_UNLOCKED 0
+inline std::recursive_mutex hostCritical;
+#define portENTER_CRITICAL(m) ((void)(m), hostCritical.lock())
+#define portEXIT_CRITICAL(m) ((void)(m), hostCritical.unlock())
+#define portMAX_DELAY 0xFFFFFFFFu
+#define pdTRUE 1
+#define pdFALSE 0
+typedef struct HostSemaphore { int taken; }* SemaphoreHandle_t;
+inline SemaphoreHandle_t xSemaphoreCreateMutex() { return new HostSemaphore{ 0 }; }
+// Only the test's own thread takes these, so taking a held mutex would
+// block forever: fail loudly
+inline int xSemaphoreTake(SemaphoreHandle_t s, uint32_t) {
+    if (s->taken) { fprintf(stderr, "xSemaphoreTake: mutex already held\n"); abort(); }
+    s->taken = 1;
+    return 1;
+}
+inline int xSemaphoreGive(SemaphoreHandle_t s) { int was = s->taken; s->taken = 0; return was; }
+
+// --- FreeRTOS tasks: detached threads with a notification count ---
+struct HostTask {
+    std::mutex m;
+    std::condition_variable cv;
+    uint32_t notes = 0;
+};
+typedef HostTask* TaskHandle_t;
+inline thread_local HostTask* hostCurrentTask = nullptr;
+inline int xTaskCreatePinnedToCore(void (*fn)(void*), const char*, uint32_t, void* arg,
+                                   unsigned, TaskHandle_t* out, int) {
+    HostTask* t = new HostTask();
+    if (out) *out = t;
+    std::thread([fn, arg, t] { hostCurrentTask = t; fn(arg); }).detach();
+    return pdTRUE;
+}
+inline uint32_t ulTaskNotifyTake(int clear, uint32_t) {
+    HostTask* t = hostCurrentTask;
+    std::unique_lock<std::mutex> l(t->m);
+    t->cv.wait(l, [t] { return t->notes != 0; });
+    uint32_t n = t->notes;
+    t->notes = clear ? 0 : n - 1;
+    return n;
+}
+inline void xTaskNotifyGive(TaskHandle_t t) {
+    { std::lock_guard<std::mutex> l(t->m); t->notes++; }
+    t->cv.notify_one();
+}
+
+class String {
+public:
+    String() {}
+    String(const char* s) : s_(s ? s : "") {}
+    String(const char* s, size_t n) : s_(s, n) {}
+    String(const std::string& s) : s_(s) {}
+    explicit String(char c) : s_(1, c) {}
+    explicit String(int v) : s_(std::to_string(v)) {}
+    explicit String(unsigned v) : s_(std::to_string(v)) {}
+    explicit String(long v) : s_(std::to_string(v)) {}
+    explicit String(unsigned long v) : s_(std::to_string(v)) {}
+    String(float v, unsigned decimals) { char b[32]; snprintf(b, sizeof(b), "%.*f", decimals, v); s_ = b; }
+    String(double v, unsigned decimals) { char b[32]; snprintf(b, sizeof(b), "%.*f", decimals, v); s_ = b; }
+
+    const char* c_str() const { return s_.c_str(); }
+    unsigned length() const { return s_.size(); }
+    bool isEmpty() const { return s_.empty(); }
+    bool reserve(unsigned n) { s_.reserve(n); return true; }
+    char charAt(unsigned i) const { return i < s_.size() ? s_[i] : 0; }
+    char operator[](unsigned i) const { return charAt(i); }
+
+    String& operator=(const char* s) { s_ = s ? s : ""; return *this; }
+    String& operator+=(const String& o) { s_ += o.s_; return *this; }
+    String& operator+=(const char* s) { s_ += s; return *this; }
+    String& operator+=(char c) { s_ += c; return *this; }
+    String& operator+=(int v) { s_ += std::to_string(v); return *this; }
+    String& operator+=(unsigned v) { s_ += std::to_string(v); return *this; }
+    bool concat(const char* s, unsigned n) { s_.append(s, n); return true; }
+    bool concat(const String& o) { s_ += o.s_; return true; }
+
+    friend String operator+(const String& a, const String& b) { return String(a.s_ + b.s_); }
+    friend String operator+(const String& a, const char* b) { return String(a.s_ + b); }
+    friend String operator+(const char* a, const String& b) { return String(a + b.s_); }
+    friend String operator+(const String& a, char c) { return String(a.s_ + c); }
+    friend String operator+(const String& a, int v) { return String(a.s_ + std::to_string(v)); }
+
+    bool operator==(const String& o) const { return s_ == o.s_; }
+    bool operator==(const char* o) const { return s_ == (o ? o : ""); }
+    bool operator!=(const String& o) const { return s_ != o.s_; }
+    bool operator!=(const char* o) const { return !(*this == o); }
+    bool operator<(const String& o) const { return s_ < o.s_; }
+
+    int indexOf(char c, unsigned from = 0) const { auto p = s_.find(c, from); return p == std::string::npos ? -1 : (int)p; }
+    int indexOf(const char* t, unsigned from = 0) const { auto p = s_.find(t, from); return p == std::string::npos ? -1 : (int)p; }
+    int indexOf(const String& t, unsigned from = 0) const { return indexOf(t.c_str(), from); }
+    int lastIndexOf(char c) const { auto p = s_.rfind(c); return p == std::string::npos ? -1 : (int)p; }
+    bool startsWith(const String& p) const { return s_.compare(0, p.s_.size(), p.s_) == 0; }
+    bool endsWith(const String& p) const {
+        return s_.size() >= p.s_.size() && s_.compare(s_.size() - p.s_.size(), p.s_.size(), p.s_) == 0;
+    }
+    String substring(unsigned from) const { return from < s_.size() ? String(s_.substr(from)) : String(); }
+    String substring(unsigned from, unsigned to) const {
+        if (from > to) std::swap(from, to);
+        return from < s_.size() ? String(s_.substr(from, to - from)) : String();
+    }
+    void remove(unsigned idx, unsigned n = (unsigned)-1) { if (idx < s_.size()) s_.erase(idx, n); }
+    void toLowerCase() { for (auto& c : s_) c = (char)tolower((unsigned char)c); }
+    void trim() {
+        size_t a = s_.find_first_not_of(" \t\r\n"), b = s_.find_last_not_of(" \t\r\n");
+        s_ = a == std::string::npos ? "" : s_.substr(a, b - a + 1);
+    }
+    long toInt() const { return strtol(s_.c_str(), nullptr, 10); }
+    float toFloat() const { return strtof(s_.c_str(), nullptr); }
+
+private:
+    std::string s_;
+};
+
+class Print {
+public:
+    virtual ~Print() {}
+    virtual size_t write(uint8_t c) = 0;
+    virtual size_t write(const uint8_t* p, size_t n) {
+        size_t k = 0;
+        while (n--) k += write(*p++);
+        return k;
+    }
+    size_t write(const char* s) { return write((const uint8_t*)s, strlen(s)); }
+    size_t write(const char* s, size_t n) { return write((const uint8_t*)s, n); }
+    size_t print(const char* s) { return write(s); }
+    size_t print(const String& s) { return write(s.c_str(), s.length()); }
+    size_t print(char c) { return write((uint8_t)c); }
+    size_t print(int v) { return printf("%d", v); }
+    size_t print(unsigned v) { return printf("%u", v); }
+    size_t println(const char* s = "") { return print(s) + print('\n'); }
+    size_t println(const String& s) { return print(s) + print('\n'); }
+    size_t printf(const char* fmt, ...) __attribute__((format(printf, 2, 3))) {
+        va_list a, b;
+        va_start(a, fmt);
+        va_copy(b, a);
+        char small[128];
+        int n = vsnprintf(small, sizeof(small), fmt, a);
+        va_end(a);
+        size_t out;
+        if (n < (int)sizeof(small)) {
+            out = write((const uint8_t*)small, n);
+        } else {
+            std::string big(n + 1, '\0');
+            vsnprintf(&big[0], n + 1, fmt, b);
+            out = write((const uint8_t*)big.data(), n);
+        }
+        va_end(b);
+        return out;
+    }
+};
+
+// Log output goes to stderr so it doesn't mix with test results
+class HostSerial : public Print {
+public:
+    size_t write(uint8_t c) override { fputc(c, stderr); return 1; }
+    size_t write(const uint8_t* p, size_t n) override { return fwrite(p, 1, n, stderr); }
+    void begin(unsigned long) {}
+};
+inline HostSerial Serial;
+
+class EspClass {
+public:
+    uint32_t getFreeHeap() { return 200000; }
+    uint32_t getMinFreeHeap() { return 150000; }
+    uint32_t getPsramSize() { return 8u << 20; }
+    uint32_t getFreePsram() { return 6u << 20; }
+};
+inline EspClass ESP;
@@ -0,0 +1,70 @@
+// Host stand-in for ArduinoJson: the names the headers under test mention,
+// and the writing side of a document (flat objects of strings and numbers,
+// serialized in insertion order). Nothing here parses JSON.
+#pragma once
+#include <Arduino.h>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+struct JsonVariantConst {};
+
+template <typename TAllocator>
+class BasicJsonDocument {
+public:
+    explicit BasicJsonDocument(size_t capa) : capa_(capa) {}
+    size_t capacity() const { return capa_; }
+private:
+    size_t capa_;
+};
+
+class JsonDocument {
+public:
+    class Member {
+    public:
+        explicit Member(std::string& v) : v_(v) {}
+        Member& operator=(const char* s) { quote(s ? s : ""); return *this; }
+        Member& operator=(const String& s) { quote(s.c_str()); return *this; }
+        Member& operator=(bool b) { v_ = b ? "true" : "false"; return *this; }
+        template <typename T, typename = std::enable_if_t<std::is_arithmetic<T>::value>>
+        Member& operator=(T n) {
+            v_ = std::is_floating_point<T>::value ? std::to_string((double)n) : std::to_string(n);
+            return *this;
+        }
+    private:
+        std::string& v_;
+        void quote(const char* s) {
+            v_ = "\"";
+            for (; *s; ++s) {
+                if (*s == '"' || *s == '\\') v_ += '\\';
+                if ((uint8_t)*s < 0x20) { char u[8]; snprintf(u, sizeof(u), "\\u%04x", *s); v_ += u; }
+                else v_ += *s;
+            }
+            v_ += '"';
+        }
+    };
+
+    Member operator[](const char* key) {
+        for (auto& m : members_) if (m.first == key) return Member(m.second);
+        members_.push_back({ key, "null" });
+        return Member(members_.back().second);
+    }
+
+    size_t write(Print& out) const {
+        size_t n = out.print('{');
+        for (size_t i = 0; i < members_.size(); ++i) {
+            if (i) n += out.print(',');
+            n += out.printf("\"%s\":%s", members_[i].first.c_str(), members_[i].second.c_str());
+        }
+        return n + out.print('}');
+    }
+
+private:
+    std::vector<std::pair<std::string, std::string>> members_;
+};
+
+template <size_t N>
+class StaticJsonDocument : public JsonDocument {};
+
+inline size_t serializeJson(const JsonDocument& doc, Print& out) { return doc.write(out); }
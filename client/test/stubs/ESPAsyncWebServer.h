@@ -0,0 +1,130 @@
+// Host stand-in for ESPAsyncWebServer. Responses keep their body source so
+// tests can pull the bytes out the way the TCP stack would; routes are
+// recorded and can be invoked by URL.
+#pragma once
+
+#include <Arduino.h>
+#include <functional>
+#include <map>
+#include <vector>
+
+enum WebRequestMethod { HTTP_GET = 1, HTTP_POST = 2, HTTP_ANY = 3 };
+
+typedef std::function<size_t(uint8_t*, size_t, size_t)> AwsResponseFiller;
+
+class AsyncWebServerResponse {
+public:
+    virtual ~AsyncWebServerResponse() {}
+    int code = 200;
+    String contentType;
+    String body;                    // fixed bodies
+    AwsResponseFiller filler;       // callback and chunked bodies
+    size_t length = 0;              // callback bodies; 0 = chunked
+    std::vector<std::pair<String, String>> headers;
+
+    void setCode(int c) { code = c; }
+    void addHeader(const String& k, const String& v) { headers.push_back({ k, v }); }
+
+    // Drain the body in maxLen pieces, as the server would
+    std::string drain(size_t maxLen = 1436) {
+        if (!filler) return std::string(body.c_str(), body.length());
+        std::string out;
+        std::vector<uint8_t> buf(maxLen);
+        size_t index = 0;
+        for (;;) {
+            size_t want = length && length - index < maxLen ? length - index : maxLen;
+            if (length && !want) break;
+            size_t n = filler(buf.data(), want, index);
+            if (!n) break;
+            out.append((const char*)buf.data(), n);
+            index += n;
+        }
+        return out;
+    }
+};
+
+class AsyncResponseStream : public AsyncWebServerResponse, public Print {
+public:
+    size_t write(uint8_t c) override { body += (char)c; return 1; }
+    size_t write(const uint8_t* p, size_t n) override { body.concat((const char*)p, n); return n; }
+    using Print::write;
+};
+
+class AsyncWebParameter {
+public:
+    AsyncWebParameter(const String& v) : v_(v) {}
+    const String& value() const { return v_; }
+private:
+    String v_;
+};
+
+class AsyncWebServerRequest {
+public:
+    void* _tempObject = nullptr;
+    std::map<std::string, AsyncWebParameter*> params;
+    std::vector<String> pathArgs;
+    AsyncWebServerResponse* sent = nullptr;
+
+    ~AsyncWebServerRequest() {
+        for (auto& p : params) delete p.second;
+        delete sent;
+        free(_tempObject);
+    }
+
+    void addParam(const char* k, const String& v) { params[k] = new AsyncWebParameter(v); }
+    bool hasParam(const char* k) const { return params.count(k) != 0; }
+    AsyncWebParameter* getParam(const char* k) const { auto it = params.find(k); return it == params.end() ? nullptr : it->second; }
+    const String& pathArg(size_t i) const { return pathArgs[i]; }
+    bool hasHeader(const char*) const { return false; }
+
+    AsyncWebServerResponse* beginResponse(int code, const String& type = String(), const String& body = String()) {
+        auto* r = new AsyncWebServerResponse();
+        r->code = code; r->contentType = type; r->body = body;
+        return r;
+    }
+    AsyncWebServerResponse* beginResponse(const String& type, size_t len, AwsResponseFiller f) {
+        auto* r = new AsyncWebServerResponse();
+        r->contentType = type; r->length = len; r->filler = f;
+        return r;
+    }
+    AsyncWebServerResponse* beginChunkedResponse(const String& type, AwsResponseFiller f) {
+        auto* r = new AsyncWebServerResponse();
+        r->contentType = type; r->filler = f;
+        return r;
+    }
+    AsyncResponseStream* beginResponseStream(const String& type) {
+        auto* r = new AsyncResponseStream();
+        r->contentType = type;
+        return r;
+    }
+    void send(AsyncWebServerResponse* r) { delete sent; sent = r; }
+    void send(int code, const String& type = String(), const String& body = String()) { send(beginResponse(code, type, body)); }
+};
+
+typedef std::function<void(AsyncWebServerRequest*)> ArRequestHandlerFunction;
+typedef std::function<void(AsyncWebServerRequest*, const String&, size_t, uint8_t*, size_t, bool)> ArUploadHandlerFunction;
+typedef std::function<void(AsyncWebServerRequest*, uint8_t*, size_t, size_t, size_t)> ArBodyHandlerFunction;
+
+class AsyncWebServer {
+public:
+    explicit AsyncWebServer(uint16_t = 80) {}
+    struct Route {
+        String uri;
+        int method;
+        ArRequestHandlerFunction onRequest;
+        ArBodyHandlerFunction onBody;
+    };
+    std::vector<Route> routes;
+
+    void on(const char* uri, int method, ArRequestHandlerFunction f) { routes.push_back({ uri, method, f, nullptr }); }
+    void on(const char* uri, int method, ArRequestHandlerFunction f, ArUploadHandlerFunction,
+            ArBodyHandlerFunction body = nullptr) { routes.push_back({ uri, method, f, body }); }
+    void onNotFound(ArRequestHandlerFunction) {}
+    void begin() {}
+
+    // Exact-match dispatch (regex routes are not resolved)
+    const Route* find(const char* uri, int method) const {
+        for (const Route& r : routes) if (r.uri == uri && (r.method & method)) return &r;
+        return nullptr;
+    }
+};
@@ -0,0 +1,99 @@
+// Host stand-in for the ESP32 HTTPClient: a blocking POST over a real
+// socket with Connection: close, enough to talk to a stand-in server on
+// localhost. Error codes match the real library's.
+#pragma once
+
+#include <Arduino.h>
+#include <arpa/inet.h>
+#include <netdb.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <unistd.h>
+
+#define HTTPC_ERROR_CONNECTION_REFUSED  (-1)
+#define HTTPC_ERROR_SEND_PAYLOAD_FAILED (-3)
+#define HTTPC_ERROR_NOT_CONNECTED       (-4)
+#define HTTPC_ERROR_READ_TIMEOUT        (-11)
+
+class HTTPClient {
+public:
+    void setTimeout(uint16_t ms) { timeoutMs_ = ms; }
+
+    bool begin(const String& url) {
+        const char* u = url.c_str();
+        if (strncmp(u, "http://", 7)) return false;
+        u += 7;
+        const char* colon = strchr(u, ':');
+        const char* slash = strchr(u, '/');
+        if (!slash) slash = u + strlen(u);
+        if (colon && colon < slash) {
+            host_.assign(u, colon - u);
+            port_ = atoi(colon + 1);
+        } else {
+            host_.assign(u, slash - u);
+            port_ = 80;
+        }
+        path_ = *slash ? slash : "/";
+        return true;
+    }
+
+    void addHeader(const String& k, const String& v) {
+        headers_ += k.c_str();
+        headers_ += ": ";
+        headers_ += v.c_str();
+        headers_ += "\r\n";
+    }
+
+    int POST(const uint8_t* body, size_t len) {
+        addrinfo hints = {}, *ai = nullptr;
+        hints.ai_family = AF_INET;
+        hints.ai_socktype = SOCK_STREAM;
+        if (getaddrinfo(host_.c_str(), std::to_string(port_).c_str(), &hints, &ai) || !ai) return HTTPC_ERROR_CONNECTION_REFUSED;
+        int fd = socket(AF_INET, SOCK_STREAM, 0);
+        timeval tv = { timeoutMs_ / 1000, (timeoutMs_ % 1000) * 1000 };
+        setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+        setsockopt(fd, SOL_SOCKET, SO_SNDTIMEO, &tv, sizeof(tv));
+        int rc = connect(fd, ai->ai_addr, ai->ai_addrlen);
+        freeaddrinfo(ai);
+        if (rc) { close(fd); return HTTPC_ERROR_CONNECTION_REFUSED; }
+
+        std::string req = "POST " + path_ + " HTTP/1.1\r\nHost: " + host_ + "\r\n" + headers_ +
+                          "Content-Length: " + std::to_string(len) + "\r\nConnection: close\r\n\r\n";
+        req.append((const char*)body, len);
+        for (size_t off = 0; off < req.size();) {
+            ssize_t n = send(fd, req.data() + off, req.size() - off, MSG_NOSIGNAL);
+            if (n <= 0) { close(fd); return HTTPC_ERROR_SEND_PAYLOAD_FAILED; }
+            off += n;
+        }
+
+        std::string resp;
+        char buf[1024];
+        ssize_t n;
+        while ((n = recv(fd, buf, sizeof(buf), 0)) > 0) resp.append(buf, n);
+        close(fd);
+        if (n < 0 && resp.empty()) return HTTPC_ERROR_READ_TIMEOUT;
+        int code = 0;
+        if (sscanf(resp.c_str(), "HTTP/%*s %d", &code) != 1) return HTTPC_ERROR_NOT_CONNECTED;
+        size_t split = resp.find("\r\n\r\n");
+        body_ = split == std::string::npos ? "" : resp.substr(split + 4);
+        return code;
+    }
+
+    String getString() { return String(body_); }
+    void end() {}
+
+    static String errorToString(int code) {
+        switch (code) {
+            case HTTPC_ERROR_CONNECTION_REFUSED:  return "connection refused";
+            case HTTPC_ERROR_SEND_PAYLOAD_FAILED: return "send payload failed";
+            case HTTPC_ERROR_NOT_CONNECTED:       return "not connected";
+            case HTTPC_ERROR_READ_TIMEOUT:        return "read Timeout";
+            default:                              return "unknown error";
+        }
+    }
+
+private:
+    std::string host_, path_, headers_, body_;
+    int port_ = 80;
+    uint16_t timeoutMs_ = 5000;
+};
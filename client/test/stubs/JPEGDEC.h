@@ -0,0 +1,69 @@
+// Host stand-in for JPEGDEC: the "file" is a pixel function set by the test.
+// decode() hands out 16x16 MCUs of the DCT-scaled image the way the library
+// does; a scaled pixel is the per-channel average of its source cell.
+#pragma once
+#include <Arduino.h>
+#include <algorithm>
+#include <functional>
+#include <vector>
+
+#define JPEG_SCALE_HALF      2
+#define JPEG_SCALE_QUARTER   4
+#define JPEG_SCALE_EIGHTH    8
+#define RGB565_LITTLE_ENDIAN 0
+#define RGB565_BIG_ENDIAN    1
+
+struct JPEGDRAW {
+    int x, y, iWidth, iHeight, iBpp;
+    uint16_t* pPixels;
+};
+typedef int JPEG_DRAW_CALLBACK(JPEGDRAW* pDraw);
+
+class JPEGDEC {
+public:
+    int w = 0, h = 0;                                   // set by the test
+    std::function<uint16_t(int x, int y)> pixel;        // native RGB565
+
+    int openRAM(uint8_t*, int, JPEG_DRAW_CALLBACK* cb) { cb_ = cb; return w > 0 && h > 0; }
+    int getWidth() { return w; }
+    int getHeight() { return h; }
+    void setPixelType(int t) { type_ = t; }
+    void close() {}
+
+    int decode(int, int, int options) {
+        int s = options & (JPEG_SCALE_HALF | JPEG_SCALE_QUARTER | JPEG_SCALE_EIGHTH);
+        if (!s) s = 1;
+        int sw = (w + s - 1) / s, sh = (h + s - 1) / s;
+        std::vector<uint16_t> mcu(16 * 16);
+        for (int by = 0; by < sh; by += 16) {
+            for (int bx = 0; bx < sw; bx += 16) {
+                for (int j = 0; j < 16; ++j) {
+                    for (int i = 0; i < 16; ++i) {
+                        // Padding past the edge repeats the last pixel
+                        uint16_t p = cell(std::min(bx + i, sw - 1) * s, std::min(by + j, sh - 1) * s, s);
+                        mcu[j * 16 + i] = type_ == RGB565_BIG_ENDIAN ? (uint16_t)(p << 8 | p >> 8) : p;
+                    }
+                }
+                JPEGDRAW d = { bx, by, 16, 16, 16, mcu.data() };
+                if (!cb_(&d)) return 0;
+            }
+        }
+        return 1;
+    }
+
+private:
+    JPEG_DRAW_CALLBACK* cb_ = nullptr;
+
+    uint16_t cell(int x0, int y0, int s) {
+        unsigned r = 0, g = 0, b = 0, n = 0;
+        for (int y = y0; y < std::min(y0 + s, h); ++y) {
+            for (int x = x0; x < std::min(x0 + s, w); ++x, ++n) {
+                uint16_t p = pixel(x, y);
+                r += p >> 11; g += (p >> 5) & 0x3F; b += p & 0x1F;
+            }
+        }
+        return (r + n / 2) / n << 11 | (g + n / 2) / n << 5 | (b + n / 2) / n;
+    }
+
+    int type_ = RGB565_LITTLE_ENDIAN;
+};
@@ -0,0 +1,39 @@
+// Host stand-in for LovyanGFX: enough for settings.h to declare the panel.
+// Drawing calls are no-ops; the image tests capture pixels at RenderPipe.
+#pragma once
+#include <Arduino.h>
+
+#define SPI2_HOST        1
+#define SPI_DMA_CH_AUTO  3
+#define TFT_WHITE        0xFFFF
+#define TFT_BLACK        0x0000
+
+namespace lgfx {
+    struct Config {
+        int spi_host, spi_mode, freq_write, freq_read, dma_channel;
+        bool spi_3wire, use_lock, invert;
+        int pin_sclk, pin_mosi, pin_miso, pin_dc, pin_cs, pin_rst, pin_bl;
+        int panel_width, panel_height, memory_width, memory_height, offset_x, offset_y, offset_rotation;
+    };
+    struct Configurable {
+        Config cfg_ = {};
+        Config config() const { return cfg_; }
+        void config(const Config& c) { cfg_ = c; }
+    };
+    struct Bus_SPI : Configurable {};
+    struct Light_PWM : Configurable {};
+    struct Panel_ST7789 : Configurable {
+        void setBus(Bus_SPI*) {}
+        void setLight(Light_PWM*) {}
+    };
+    class LGFX_Device {
+    public:
+        void setPanel(Panel_ST7789*) {}
+        int width() const { return 320; }
+        int height() const { return 172; }
+        void fillScreen(uint16_t) {}
+        void startWrite() {}
+        void endWrite() {}
+    };
+}
+namespace fonts { inline int Font2; }
@@ -0,0 +1,53 @@
+// Host stand-in for the NVS-backed Preferences: one in-memory store shared
+// by every instance, counting each call that would write flash.
+#pragma once
+
+#include <Arduino.h>
+#include <map>
+#include <vector>
+
+class Preferences {
+public:
+    static inline std::map<std::string, std::vector<uint8_t>> store;
+    static inline unsigned writes = 0;      // put*/remove calls
+    static void reset() { store.clear(); writes = 0; }
+
+    bool begin(const char* ns, bool readOnly = false) { prefix = std::string(ns) + "/"; ro = readOnly; return true; }
+    void end() {}
+
+    bool isKey(const char* k) { return store.count(prefix + k) != 0; }
+    bool remove(const char* k) { writes++; return store.erase(prefix + k) != 0; }
+    bool clear() { writes++; return true; }
+
+    size_t getBytes(const char* k, void* buf, size_t n) {
+        auto it = store.find(prefix + k);
+        if (it == store.end() || it->second.size() > n) return 0;
+        memcpy(buf, it->second.data(), it->second.size());
+        return it->second.size();
+    }
+    size_t getBytesLength(const char* k) { auto it = store.find(prefix + k); return it == store.end() ? 0 : it->second.size(); }
+    size_t putBytes(const char* k, const void* buf, size_t n) {
+        writes++;
+        store[prefix + k].assign((const uint8_t*)buf, (const uint8_t*)buf + n);
+        return n;
+    }
+
+    String getString(const char* k, const String& def = String()) {
+        auto it = store.find(prefix + k);
+        return it == store.end() ? def : String(std::string(it->second.begin(), it->second.end()));
+    }
+    size_t putString(const char* k, const String& v) { return putBytes(k, v.c_str(), v.length()); }
+
+    int32_t getInt(const char* k, int32_t def = 0) { int32_t v; return getBytes(k, &v, 4) == 4 ? v : def; }
+    size_t putInt(const char* k, int32_t v) { return putBytes(k, &v, 4); }
+    uint32_t getUInt(const char* k, uint32_t def = 0) { uint32_t v; return getBytes(k, &v, 4) == 4 ? v : def; }
+    size_t putUInt(const char* k, uint32_t v) { return putBytes(k, &v, 4); }
+    float getFloat(const char* k, float def = 0) { float v; return getBytes(k, &v, 4) == 4 ? v : def; }
+    size_t putFloat(const char* k, float v) { return putBytes(k, &v, 4); }
+    bool getBool(const char* k, bool def = false) { uint8_t v; return getBytes(k, &v, 1) == 1 ? v : def; }
+    size_t putBool(const char* k, bool v) { uint8_t b = v; return putBytes(k, &b, 1); }
+
+private:
+    std::string prefix;
+    bool ro = false;
+};
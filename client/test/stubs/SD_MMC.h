@@ -0,0 +1,105 @@
+// Host stand-in for the SD_MMC card: an in-memory tree of files. Tests
+// fill it with SD_MMC.put(); a file's parent directories exist implicitly.
+#pragma once
+
+#include <Arduino.h>
+#include <ctime>
+#include <map>
+#include <memory>
+
+#define FILE_READ   "r"
+#define FILE_WRITE  "w"
+
+namespace fs {
+
+struct HostNode {
+    bool dir = false;
+    std::string data;
+    time_t mtime = 0;
+};
+
+class File {
+public:
+    File() {}
+    File(std::map<std::string, HostNode>* tree, const std::string& path)
+        : st_(std::make_shared<State>()) {
+        st_->tree = tree;
+        st_->path = path;
+        size_t slash = path.rfind('/');
+        st_->name = slash == std::string::npos ? path : path.substr(slash + 1);
+    }
+
+    explicit operator bool() const { return st_ && st_->open; }
+    void close() { if (st_) st_->open = false; }
+
+    const char* name() const { return st_->name.c_str(); }
+    const char* path() const { return st_->path.c_str(); }
+    bool isDirectory() const { return node().dir; }
+    size_t size() const { return node().data.size(); }
+    time_t getLastWrite() const { return node().mtime; }
+    size_t position() const { return st_->pos; }
+    bool seek(size_t pos) { st_->pos = pos; return pos <= size(); }
+    int available() const { return st_->pos < size() ? (int)(size() - st_->pos) : 0; }
+
+    int read(uint8_t* buf, size_t n) {
+        const std::string& d = node().data;
+        if (st_->pos >= d.size()) return 0;
+        if (n > d.size() - st_->pos) n = d.size() - st_->pos;
+        memcpy(buf, d.data() + st_->pos, n);
+        st_->pos += n;
+        return (int)n;
+    }
+
+    // Entries directly under this directory, in path order
+    File openNextFile() {
+        std::string prefix = st_->path == "/" ? "/" : st_->path + "/";
+        auto it = st_->cursor.empty() ? st_->tree->lower_bound(prefix)
+                                      : st_->tree->upper_bound(st_->cursor);
+        for (; it != st_->tree->end() && it->first.compare(0, prefix.size(), prefix) == 0; ++it) {
+            if (it->first.find('/', prefix.size()) != std::string::npos) continue;
+            st_->cursor = it->first;
+            return File(st_->tree, it->first);
+        }
+        st_->cursor = prefix + "\xff";
+        return File();
+    }
+
+private:
+    struct State {
+        std::map<std::string, HostNode>* tree;
+        std::string path, name, cursor;
+        size_t pos = 0;
+        bool open = true;
+    };
+    std::shared_ptr<State> st_;
+
+    const HostNode& node() const { return st_->tree->at(st_->path); }
+};
+
+class FS {
+public:
+    std::map<std::string, HostNode> tree;
+
+    void put(const std::string& path, const std::string& data = "", time_t mtime = 0) {
+        for (size_t s = path.find('/', 1); s != std::string::npos; s = path.find('/', s + 1)) {
+            tree[path.substr(0, s)].dir = true;
+        }
+        HostNode& n = tree[path];
+        n.data = data;
+        n.mtime = mtime;
+    }
+    void clear() { tree.clear(); }
+
+    File open(const String& path, const char* = FILE_READ) { return open(path.c_str()); }
+    File open(const char* path, const char* = FILE_READ) {
+        return tree.count(path) ? File(&tree, path) : File();
+    }
+    bool exists(const String& path) { return tree.count(path.c_str()) != 0; }
+    bool exists(const char* path) { return tree.count(path) != 0; }
+    bool remove(const String& path) { return tree.erase(path.c_str()) != 0; }
+};
+
+}   // namespace fs
+
+using fs::File;
+inline fs::FS SD_MMC;
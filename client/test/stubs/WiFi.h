@@ -0,0 +1,3 @@
+// Host stand-in for WiFi.h: nothing under test calls into it yet.
+#pragma once
+#include <Arduino.h>
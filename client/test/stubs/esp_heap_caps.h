@@ -0,0 +1,39 @@
+// Host stand-in for ESP-IDF heap_caps: plain malloc, with the free-space
+// figures the pool sizing reads settable by tests.
+#pragma once
+
+#include <cstdlib>
+#include <cstdint>
+#include <cstring>
+#include <malloc.h>
+
+#define MALLOC_CAP_SPIRAM    (1 << 0)
+#define MALLOC_CAP_INTERNAL  (1 << 1)
+#define MALLOC_CAP_8BIT      (1 << 2)
+#define MALLOC_CAP_DMA       (1 << 3)
+
+inline size_t hostPsramFree = 8u << 20;
+
+typedef struct {
+    size_t total_free_bytes;
+    size_t total_allocated_bytes;
+    size_t largest_free_block;
+    size_t minimum_free_bytes;
+    size_t allocated_blocks;
+    size_t free_blocks;
+    size_t total_blocks;
+} multi_heap_info_t;
+
+inline void* heap_caps_malloc(size_t n, uint32_t) { return malloc(n); }
+inline void* heap_caps_calloc(size_t n, size_t s, uint32_t) { return calloc(n, s); }
+inline void* heap_caps_realloc(void* p, size_t n, uint32_t) { return realloc(p, n); }
+inline void* heap_caps_aligned_alloc(size_t a, size_t n, uint32_t) { return aligned_alloc(a, (n + a - 1) / a * a); }
+inline void heap_caps_free(void* p) { free(p); }
+inline size_t heap_caps_get_allocated_size(void* p) { return malloc_usable_size(p); }
+inline size_t heap_caps_get_free_size(uint32_t) { return hostPsramFree; }
+inline size_t heap_caps_get_largest_free_block(uint32_t) { return hostPsramFree; }
+inline size_t heap_caps_get_minimum_free_size(uint32_t) { return hostPsramFree; }
+inline void heap_caps_get_info(multi_heap_info_t* info, uint32_t) {
+    memset(info, 0, sizeof(*info));
+    info->total_free_bytes = info->largest_free_block = hostPsramFree;
+}
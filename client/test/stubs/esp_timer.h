@@ -0,0 +1,4 @@
+// Host stand-in for esp_timer: the test clock from Arduino.h
+#pragma once
+#include <Arduino.h>
+inline int64_t esp_timer_get_time() { return (int64_t)hostMicros; }
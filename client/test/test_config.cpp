@@ -0,0 +1,112 @@
+// NVS writes for the common config flows, counted at the Preferences layer
+#include "../config.h"
+#include "harness.h"
+#include <Preferences.h>
+
+// Fresh store seeded with what a pre-blob firmware left behind
+static void legacyStore() {
+    Preferences::reset();
+    Preferences p;
+    p.begin("devcfg");
+    p.putString("devname", "Kitchen");
+    p.putString("server", "10.0.0.5:6969");
+    p.putInt("tz", -18000);
+    p.putString("postal", "10001");
+    p.end();
+    Preferences::writes = 0;
+}
+
+static void settle() {
+    hostAdvanceMs(CONFIG_COMMIT_DELAY_MS);
+    Config::loop();
+}
+
+TEST(config_migration_is_one_write_plus_cleanup) {
+    legacyStore();
+    Config::begin();
+    DeviceConfig& c = Config::get();
+    CHECK(c.deviceName == "Kitchen");
+    CHECK(c.serverAddress == "10.0.0.5:6969");
+    CHECK(c.timezone == -18000);
+    CHECK(c.weatherPostal == "10001");
+    // One blob write, then one remove per legacy key
+    CHECK(Preferences::store.count("devcfg/cfg") == 1);
+    CHECK(Preferences::store.count("devcfg/devname") == 0);
+    CHECK(Preferences::writes == 1 + 8);
+    printf("    migration: %u NVS calls\n", Preferences::writes);
+
+    // A second boot reads the blob and writes nothing
+    Preferences::writes = 0;
+    Config::begin();
+    settle();
+    CHECK(Preferences::writes == 0);
+}
+
+TEST(config_save_burst_coalesces_to_one_write) {
+    legacyStore();
+    Config::begin();
+    Preferences::writes = 0;
+    DeviceConfig& c = Config::get();
+    for (int i = 0; i < 5; ++i) {
+        c.weatherPostal = String("2000") + i;
+        Config::save();
+        hostAdvanceMs(200);
+        Config::loop();
+    }
+    CHECK(Preferences::writes == 0);        // still inside the delay
+    settle();
+    CHECK(Preferences::writes == 1);
+    printf("    5 saves 200 ms apart: %u NVS write(s)\n", Preferences::writes);
+}
+
+TEST(config_ntp_stamp_skips_the_blob) {
+    legacyStore();
+    Config::begin();
+    Preferences::writes = 0;
+    Config::setNtpTime("2024-02-02 00:00:00");
+    settle();
+    CHECK(Preferences::writes == 1);
+    CHECK(Preferences::store.count("devcfg/ntp") == 1);
+}
+
+TEST(config_unchanged_save_writes_nothing) {
+    legacyStore();
+    Config::begin();
+    Preferences::writes = 0;
+    Config::get().deviceName = "Kitchen";   // same value
+    Config::save();
+    settle();
+    CHECK(Preferences::writes == 0);
+}
+
+TEST(config_commit_flushes_immediately_and_round_trips) {
+    legacyStore();
+    Config::begin();
+    Preferences::writes = 0;
+    Config::get().deviceName = "Hallway";
+    Config::get().lat = 51.5f;
+    Config::save();
+    Config::commit();                       // e.g. before a restart
+    CHECK(Preferences::writes == 1);
+    settle();
+    CHECK(Preferences::writes == 1);
+
+    Config::load();
+    CHECK(Config::get().deviceName == "Hallway");
+    CHECK(Config::get().lat == 51.5f);
+    CHECK(Config::get().serverAddress == "10.0.0.5:6969");
+}
+
+TEST(config_lock_is_released) {
+    legacyStore();
+    Config::begin();
+    Config::lock();
+    Config::unlock();
+    Config::setNtpTime("2024-03-03 00:00:00");
+    Config::commit();
+    // commit() and setNtpTime() take the lock; a leak would trip the stub
+    Config::lock();
+    Config::unlock();
+}
+
+TEST_MAIN()
@@ -0,0 +1,59 @@
+// Server address parsing, and copies staying put across config saves
+#include "../endpoint.h"
+#include "../config.h"
+#include "harness.h"
+#include <Preferences.h>
+
+static Endpoint::Server set(const char* addr, const char* name = "Kitchen") {
+    Config::lock();
+    Config::get().serverAddress = addr;
+    Config::get().deviceName = name;
+    Config::unlock();
+    Endpoint::update();
+    return Endpoint::get();
+}
+
+TEST(endpoint_parses_address_forms) {
+    Preferences::reset();
+    Config::begin();
+
+    Endpoint::Server s = set("10.0.0.5");
+    CHECK(s.valid && !s.https && s.port == SERVER_DEFAULT_PORT);
+    CHECK(!strcmp(s.base, "http://10.0.0.5:6969"));
+    CHECK(!strcmp(s.pullUrl, "http://10.0.0.5:6969/api/pull"));
+    CHECK(!strcmp(s.checkinUrl, "http://10.0.0.5:6969/api/checkin"));
+
+    s = set(" https://love.example:8443/ ");
+    CHECK(s.valid && s.https && s.port == 8443);
+    CHECK(!strcmp(s.host, "love.example"));
+    CHECK(!strcmp(s.base, "https://love.example:8443"));
+
+    CHECK(!set("http://host:0").valid);
+    CHECK(!set("host:99999").valid);
+    CHECK(!set("host:80x").valid);
+    CHECK(!set("").valid);
+    CHECK(!set("10.0.0.5", "").valid);
+}
+
+TEST(endpoint_device_body_is_escaped_json) {
+    Preferences::reset();
+    Config::begin();
+    Endpoint::Server s = set("10.0.0.5", "Kim's \"desk\"\\");
+    CHECK(!strcmp(s.deviceBody, "{\"device_id\":\"Kim's \\\"desk\\\"\\\\\"}"));
+    CHECK(s.deviceBodyLen == strlen(s.deviceBody));
+}
+
+TEST(endpoint_copy_survives_updates) {
+    Preferences::reset();
+    Config::begin();
+    const Endpoint::Server held = set("10.0.0.5");
+    set("10.0.0.6");
+    set("10.0.0.7:7000");
+    CHECK(!strcmp(held.pullUrl, "http://10.0.0.5:6969/api/pull"));
+    char url[ENDPOINT_URL_MAX];
+    CHECK(Endpoint::url(url, sizeof(url), "/images/a.jpg"));
+    CHECK(!strcmp(url, "http://10.0.0.7:7000/images/a.jpg"));
+    CHECK(!Endpoint::url(url, 12, "/images/a.jpg"));
+}
+
+TEST_MAIN()
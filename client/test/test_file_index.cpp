@@ -0,0 +1,135 @@
+// FileIndex over a 10,000-file card: built a step at a time, paged,
+// sorted and filtered the way /api/files and fileman.html use it
+#include "../file_index.h"
+#include "harness.h"
+#include <SD_MMC.h>
+#include <set>
+#include <vector>
+
+struct Item {
+    std::string name;
+    unsigned size, mtime;
+};
+
+// Pull the items out of one writePage() result
+static std::vector<Item> items(const std::string& json, unsigned* matched = nullptr) {
+    std::vector<Item> out;
+    size_t p = json.find("\"items\":[");
+    if (p == std::string::npos) return out;
+    p += 9;
+    while (json[p] == '[') {
+        Item it;
+        size_t q = p + 2;
+        for (; json[q] != '"'; ++q) {
+            if (json[q] == '\\') ++q;
+            it.name += json[q];
+        }
+        if (sscanf(json.c_str() + q + 1, ",%u,%u]", &it.size, &it.mtime) != 2) break;
+        out.push_back(it);
+        p = json.find(']', q) + 1;
+        if (json[p] == ',') ++p;
+    }
+    if (matched) sscanf(json.c_str() + json.find("\"matched\":") + 10, "%u", matched);
+    return out;
+}
+
+class StringOut : public Print {
+public:
+    std::string s;
+    size_t write(uint8_t c) override { s += (char)c; return 1; }
+};
+
+static bool page(std::string& json, uint32_t offset, uint32_t limit,
+                 FileIndex::Sort sort = FileIndex::Sort::Name, bool desc = false, const char* q = "") {
+    StringOut out;
+    bool ok = FileIndex::writePage(out, "images", offset, limit, sort, desc, q);
+    json = out.s;
+    return ok;
+}
+
+static unsigned build() {
+    unsigned steps = 0;
+    std::string json;
+    FileIndex::begin();
+    do {
+        FileIndex::loop();
+        ++steps;
+    } while ((!page(json, 0, 1) || json.find("\"stale\":false") == std::string::npos) && steps < 100000);
+    return steps;
+}
+
+TEST(file_index_10k_files) {
+    const unsigned N = 10000;
+    SD_MMC.clear();
+    char name[48];
+    for (unsigned i = 0; i < N; ++i) {
+        // Names, sizes and times in three unrelated orders
+        snprintf(name, sizeof(name), "/images/IMG_%05u.jpg", (i * 7919) % N);
+        SD_MMC.put(name, std::string((i * 31) % 2000, 'x'), 1700000000 + (i * 104729) % N);
+    }
+    SD_MMC.put("/images/.thumbs/IMG_00001.jpg.bmp");
+
+    unsigned steps = build();
+    printf("    %u entries indexed in %u loop() steps\n", N, steps);
+    // At most FILE_INDEX_STEP entries per step, across both directories
+    CHECK(steps >= N / FILE_INDEX_STEP);
+
+    // Page through everything the way the page's infinite scroll does
+    std::set<std::string> seen;
+    std::string json, prev;
+    unsigned matched = 0;
+    for (uint32_t off = 0; off < N; off += 200) {
+        CHECK(page(json, off, 200));
+        std::vector<Item> got = items(json, &matched);
+        CHECK(got.size() == 200);
+        for (const Item& it : got) {
+            CHECK(prev < it.name);
+            prev = it.name;
+            seen.insert(it.name);
+        }
+    }
+    CHECK(matched == N);
+    CHECK(seen.size() == N);
+    CHECK(!seen.count(".thumbs"));
+    CHECK(page(json, N, 200) && items(json).empty());
+
+    CHECK(page(json, 0, 500, FileIndex::Sort::Time, true));
+    std::vector<Item> got = items(json);
+    CHECK(got.size() == 500);
+    for (size_t i = 1; i < got.size(); ++i) CHECK(got[i - 1].mtime >= got[i].mtime);
+    CHECK(got[0].mtime == 1700000000 + N - 1);
+
+    CHECK(page(json, 0, 500, FileIndex::Sort::Size));
+    got = items(json);
+    for (size_t i = 1; i < got.size(); ++i) CHECK(got[i - 1].size <= got[i].size);
+
+    CHECK(page(json, 0, 200, FileIndex::Sort::Name, false, "img_0999"));
+    got = items(json, &matched);
+    CHECK(matched == 10 && got.size() == 10);
+    CHECK(got.size() && got[0].name == "IMG_09990.jpg");
+}
+
+TEST(file_index_odd_names_and_rebuild) {
+    SD_MMC.clear();
+    SD_MMC.put("/images/a\"b'c<d>.jpg", "x");
+    std::string longName = std::string(250, 'n') + ".jpg";   // FAT's longest
+    SD_MMC.put("/images/" + longName, "xy");
+    build();
+    std::string json;
+    CHECK(page(json, 0, 10));
+    CHECK(json.find("[\"a\\\"b'c<d>.jpg\",1,0]") != std::string::npos);
+    CHECK(json.find("\"total\":2,\"skipped\":0,") != std::string::npos);
+    std::vector<Item> got = items(json);
+    CHECK(got.size() == 2 && got[1].name == longName && got[1].size == 2);
+    CHECK(page(json, 0, 10, FileIndex::Sort::Name, false, "nnnn.jpg") && items(json).size() == 1);
+
+    // The old snapshot keeps serving, marked stale, until the rebuild lands
+    SD_MMC.put("/images/new.jpg");
+    FileIndex::invalidate("/images");
+    CHECK(page(json, 0, 10) && json.find("\"stale\":true") != std::string::npos);
+    CHECK(items(json).size() == 2);
+    build();
+    CHECK(page(json, 0, 10) && items(json).size() == 3);
+}
+
+TEST_MAIN()
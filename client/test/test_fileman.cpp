@@ -0,0 +1,200 @@
+// /lb/fileman/all: names escaped for every context they land in, rows that
+// don't fit left out whole, and heap use flat from 10 files to 10,000.
+// /lb/fileman/delete: heap use of the WebArena page against the String one.
+#include "../web_fileman.h"
+#include "../display_owner.h"
+#include "../thumbs.h"
+#include "../web_assets.h"
+#include "harness.h"
+#include <SD_MMC.h>
+#include <malloc.h>
+#include <new>
+
+// --- Counting operator new: calls, live and peak bytes ---
+static size_t newCalls = 0, liveBytes = 0, peakBytes = 0;
+
+void* operator new(size_t n) {
+    void* p = malloc(n ? n : 1);
+    if (!p) throw std::bad_alloc();
+    newCalls++;
+    liveBytes += malloc_usable_size(p);
+    if (liveBytes > peakBytes) peakBytes = liveBytes;
+    return p;
+}
+void operator delete(void* p) noexcept {
+    if (p) liveBytes -= malloc_usable_size(p);
+    free(p);
+}
+void operator delete(void* p, size_t) noexcept { operator delete(p); }
+
+// --- What the file manager routes call into elsewhere ---
+bool DisplayOwner::post(Cmd, const char*, const char*, const char*) { return true; }
+String Thumbs::pathFor(const String& name) { return String(THUMB_DIR "/") + name + ".bmp"; }
+bool Thumbs::request(const String&) { return true; }
+bool Thumbs::failed(const String&) { return false; }
+void serveAsset(AsyncWebServerRequest* request, const WebAsset&) { request->send(200); }
+void sendSdFile(AsyncWebServerRequest* request, const String&, const char*, bool) { request->send(200); }
+const WebAsset ASSET_FILEMAN_HTML = { "text/html", nullptr, 0, "\"x\"" };
+const WebAsset ASSET_GALLERY_HTML = { "text/html", nullptr, 0, "\"x\"" };
+
+static AsyncWebServer server;
+
+static AsyncWebServerResponse* list(AsyncWebServerRequest& req) {
+    if (server.routes.empty()) setupFileManagerRoutes(server);
+    server.find("/lb/fileman/all", HTTP_GET)->onRequest(&req);
+    return req.sent;
+}
+
+static size_t count(const std::string& s, const char* what) {
+    size_t n = 0;
+    for (size_t p = s.find(what); p != std::string::npos; p = s.find(what, p + 1)) ++n;
+    return n;
+}
+
+TEST(fileman_list_escapes_names) {
+    SD_MMC.clear();
+    SD_MMC.put("/images/a'b<c>&d #1.jpg", std::string(3000, 'x'));
+    SD_MMC.put("/messages/note.json", "{}");
+    AsyncWebServerRequest req;
+    std::string html = list(req)->drain();
+
+    CHECK(html.find(">a&#39;b&lt;c&gt;&amp;d #1.jpg</a>") != std::string::npos);
+    CHECK(count(html, "file=a%27b%3Cc%3E%26d%20%231.jpg'") == 3);
+    CHECK(html.find("href='/images/a%27b%3Cc%3E%26d%20%231.jpg' download") != std::string::npos);
+    CHECK(html.find("a'b") == std::string::npos);
+    CHECK(html.find("2.9 KB") != std::string::npos);
+    CHECK(html.find("file=note.json'") != std::string::npos);
+    CHECK(html.find("confirm('Delete this image?')") != std::string::npos);
+}
+
+TEST(fileman_list_skips_rows_that_dont_fit) {
+    SD_MMC.clear();
+    SD_MMC.put("/images/" + std::string(200, '&') + ".jpg");
+    SD_MMC.put("/images/ok.jpg");
+    AsyncWebServerRequest req;
+    std::string html = list(req)->drain(97);
+
+    CHECK(count(html, "<tr><td><a ") == 1);
+    CHECK(html.find("file=ok.jpg'") != std::string::npos);
+    CHECK(html.find("1 file(s) with names too long to list") != std::string::npos);
+    CHECK(html.find("&amp;&amp;") == std::string::npos);
+    CHECK(count(html, "<table") == 2 && count(html, "</table>") == 2);
+    CHECK(html.find("No message files found.") != std::string::npos);
+}
+
+// Pull the body through 1436-byte chunks like the TCP stack, keeping only
+// a row count, and return the peak heap above where it started
+static size_t drainPeak(AsyncWebServerResponse* r, size_t& rows, size_t& bytes) {
+    static uint8_t buf[1436];
+    std::string carry;
+    rows = bytes = 0;
+    size_t base = liveBytes;
+    peakBytes = liveBytes;
+    for (size_t n; (n = r->filler(buf, sizeof(buf), bytes)); bytes += n) {
+        carry.append((const char*)buf, n);
+        rows += count(carry, "</tr>");
+        size_t keep = carry.size() < 4 ? carry.size() : 4;
+        carry.erase(0, carry.size() - keep);
+    }
+    return peakBytes - base;
+}
+
+TEST(fileman_list_heap_flat_at_10k_files) {
+    size_t peak[2], rows[2], bytes[2];
+    const unsigned files[2] = { 10, 10000 };
+    for (int run = 0; run < 2; ++run) {
+        SD_MMC.clear();
+        char name[48];
+        for (unsigned i = 0; i < files[run]; ++i) {
+            snprintf(name, sizeof(name), "/images/IMG_%05u.jpg", i);
+            SD_MMC.put(name, std::string(i % 4096, 'x'), 1700000000 + i);
+        }
+        AsyncWebServerRequest req;
+        size_t before = liveBytes;
+        AsyncWebServerResponse* r = list(req);
+        size_t setup = liveBytes - before;
+        peak[run] = setup + drainPeak(r, rows[run], bytes[run]);
+        printf("    %5u files: %zu rows, %zu bytes out, peak heap %zu bytes\n",
+               files[run], rows[run], bytes[run], peak[run]);
+    }
+    // a header per section, the empty /messages note, one per file
+    CHECK(rows[0] == 10 + 3);
+    CHECK(rows[1] == 10000 + 3);
+    CHECK(peak[1] <= peak[0] + 256);
+}
+
+// --- /lb/fileman/delete before and after WebArena ---
+
+// The handler as it was, building the page by String concatenation
+static void stringDeletePage(AsyncWebServerRequest* request) {
+    String type = request->hasParam("type") ? request->getParam("type")->value() : "";
+    String file = request->hasParam("file") ? request->getParam("file")->value() : "";
+    String path = (type == "image" ? "/images/" : "/messages/") + file;
+    // The main loop owns the SD card; it performs the removal
+    bool ok = file.length() && file.indexOf("..") < 0 &&
+              DisplayOwner::post(DisplayOwner::Cmd::RemoveFile, path.c_str());
+    String html = R"rawliteral(
+<!DOCTYPE html>
+<html>
+<head>
+  <title>LoveByte File Delete</title>
+  <meta name="viewport" content="width=360, initial-scale=1">
+  <meta http-equiv="refresh" content="2; url=/lb/fileman">
+  <style>
+    body { background:#101016; color:#fff; font-family:sans-serif; text-align:center; margin:0; }
+    .logo { width:128px; margin:32px auto 20px auto; display:block; border-radius:16px; box-shadow:0 0 24px #2228; }
+    .btn { display:inline-block; margin:8px 4px; padding:12px 22px; background:#ff69b4; color:#fff; border:none; border-radius:10px; font-size:1.1em; font-weight:bold; cursor:pointer; transition:background .2s; box-shadow:0 2px 10px #0004;}
+    .btn:hover { background:#f032a8; }
+    .viewtxt { white-space:pre-wrap; text-align:center; margin:20px auto; width:90%; background:#181824; color:#eee; padding:18px; border-radius:9px;}
+  </style>
+</head>
+<body>
+  <img class="logo" src="/res/splash.jpg" alt="LoveByte Logo">
+  <h2>Delete File</h2>
+)rawliteral";
+    if (ok)
+        html += "<div class='viewtxt' style='color:#aef;'>Deleting: " + file + "</div>";
+    else
+        html += "<div class='viewtxt' style='color:#faa;'>Failed to delete: " + file + "</div>";
+    html += "<br><button class='btn' onclick='location.href=\"/lb/fileman\"'>Back to File Manager</button>";
+    html += "<p style='margin-top:2em;color:#ccc;font-size:.95em;'>&copy; Darkone83</p></body></html>";
+    request->send(200, "text/html", html);
+}
+
+struct HeapUse {
+    size_t calls;   // operator new calls during the handler
+    size_t peak;    // most heap held at once during the handler
+    size_t held;    // heap still held by the response afterwards
+};
+
+static HeapUse measure(const std::function<void(AsyncWebServerRequest*)>& handler,
+                       AsyncWebServerRequest& req) {
+    size_t calls = newCalls, base = liveBytes;
+    peakBytes = liveBytes;
+    handler(&req);
+    return { newCalls - calls, peakBytes - base, liveBytes - base };
+}
+
+TEST(fileman_delete_page_heap_before_after) {
+    if (server.routes.empty()) setupFileManagerRoutes(server);
+    auto arena = server.find("/lb/fileman/delete", HTTP_GET)->onRequest;
+    for (const char* name : { "IMG_00042.jpg", "2026-10-19 birthday card for grandma, second try.jpg" }) {
+        AsyncWebServerRequest before, after;
+        for (AsyncWebServerRequest* r : { &before, &after }) {
+            r->addParam("type", "image");
+            r->addParam("file", name);
+        }
+        HeapUse b = measure(stringDeletePage, before);
+        HeapUse a = measure(arena, after);
+        printf("    %zu-char name: String %zu allocs, peak %zu B, %zu B held; "
+               "WebArena %zu allocs, peak %zu B, %zu B held\n",
+               strlen(name), b.calls, b.peak, b.held, a.calls, a.peak, a.held);
+        // Same page, byte for byte, for a name with nothing to escape
+        CHECK(before.sent->drain() == after.sent->drain(536));
+        CHECK(a.calls < b.calls);
+        CHECK(a.peak < b.peak / 2);
+        CHECK(a.held < b.held / 4);
+    }
+}
+
+TEST_MAIN()
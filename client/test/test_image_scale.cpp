@@ -0,0 +1,159 @@
+// ImageScale: the JPEG area pass at its largest ratio, and the JPEG and GIF
+// paths over odd source sizes, checked pixel by pixel on a captured panel
+#include "../image_scale.h"
+#include "../render_pipe.h"
+#include "../settings.h"
+#include "../psram_pool.h"
+#include "harness.h"
+#include <math.h>
+#include <vector>
+
+// --- RenderPipe stand-in: tiles land in a framebuffer of native RGB565 ---
+static const int PW = 320, PH = 172;
+static const uint32_t UNSET = 0x10000;      // no RGB565 value looks like this
+static std::vector<uint32_t> fb;
+static uint16_t tile[RENDER_TILE_PX];
+static int16_t tileX, tileY, tileW, tileH;
+
+static void clearPanel() { fb.assign(PW * PH, UNSET); }
+
+static void put(int x, int y, uint16_t be) {
+    CHECK(x >= 0 && x < PW && y >= 0 && y < PH);
+    if (x >= 0 && x < PW && y >= 0 && y < PH) fb[y * PW + x] = (uint16_t)(be << 8 | be >> 8);
+}
+
+uint16_t* RenderPipe::acquire(int16_t x, int16_t y, int16_t w, int16_t h) {
+    CHECK(w * h <= RENDER_TILE_PX);
+    tileX = x; tileY = y; tileW = w; tileH = h;
+    return tile;
+}
+void RenderPipe::submit() {
+    for (int j = 0; j < tileH; ++j)
+        for (int i = 0; i < tileW; ++i) put(tileX + i, tileY + j, tile[j * tileW + i]);
+}
+void RenderPipe::pushRect(int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t* px) {
+    for (int j = 0; j < h; ++j)
+        for (int i = 0; i < w; ++i) put(x + i, y + j, px[j * w + i]);
+}
+void RenderPipe::flush() {}
+
+static int red(uint32_t p) { return p >> 11; }
+static int blue(uint32_t p) { return p & 0x1F; }
+
+// Every pixel of the fitted rect written, nothing outside it
+static bool covers(const ImageScale::Fit& f) {
+    bool ok = true;
+    for (int y = 0; y < PH; ++y) {
+        for (int x = 0; x < PW; ++x) {
+            bool inside = x >= f.x && x < f.x + f.w && y >= f.y && y < f.y + f.h;
+            ok &= (fb[y * PW + x] != UNSET) == inside;
+        }
+    }
+    return ok;
+}
+
+// A source with its last column(s) blue and its last row(s) red, black
+// elsewhere: only the output's last column/row may pick them up, and they
+// must
+static bool edgesMapped(const ImageScale::Fit& f) {
+    bool ok = true;
+    for (int y = f.y; y < f.y + f.h; ++y) {
+        for (int x = f.x; x < f.x + f.w; ++x) {
+            uint32_t p = fb[y * PW + x];
+            bool lastCol = x == f.x + f.w - 1, lastRow = y == f.y + f.h - 1;
+            ok &= (blue(p) > 0) == lastCol;
+            ok &= (red(p) > 0) == lastRow;
+        }
+    }
+    return ok;
+}
+
+static uint16_t edgeMarker(int x, int y, int w, int h) {
+    return (y == h - 1 ? 0xF800 : 0) | (x == w - 1 ? 0x001F : 0);
+}
+
+TEST(jpeg_area_16_to_1_white_stays_white) {
+    PsramPool::begin();
+    clearPanel();
+    // DCT 1/8 leaves 16 source pixels per output pixel each way: 256 per sum
+    JPEGDEC dec;
+    dec.w = PW * 8 * IMAGE_SCALE_MAX_RATIO;
+    dec.h = PH * 8 * IMAGE_SCALE_MAX_RATIO;
+    dec.pixel = [](int, int) { return (uint16_t)0xFFFF; };
+    uint8_t file[1];
+    CHECK(ImageScale::drawJpeg(dec, file, sizeof(file)));
+    bool white = true;
+    for (uint32_t p : fb) white &= p == 0xFFFF;
+    CHECK(white);
+    CHECK(PsramPool::stats().usedBytes == 0);
+}
+
+TEST(jpeg_past_max_ratio_is_refused) {
+    clearPanel();
+    JPEGDEC dec;
+    dec.w = PW * 8 * (IMAGE_SCALE_MAX_RATIO + 1);
+    dec.h = PH * 8 * (IMAGE_SCALE_MAX_RATIO + 1);
+    dec.pixel = [](int, int) { return (uint16_t)0xFFFF; };
+    uint8_t file[1];
+    CHECK(!ImageScale::drawJpeg(dec, file, sizeof(file)));
+    CHECK(PsramPool::stats().usedBytes == 0);
+}
+
+TEST(jpeg_odd_sizes_map_last_column_and_row) {
+    // 1/1, 1/2 and 1/8 DCT, width- and height-limited, odd both ways
+    for (auto wh : { std::make_pair(333, 181), std::make_pair(1001, 503),
+                     std::make_pair(641, 401), std::make_pair(2999, 1203) }) {
+        clearPanel();
+        JPEGDEC dec;
+        dec.w = wh.first;
+        dec.h = wh.second;
+        dec.pixel = [&](int x, int y) { return edgeMarker(x, y, dec.w, dec.h); };
+        uint8_t file[1];
+        CHECK(ImageScale::drawJpeg(dec, file, sizeof(file)));
+        ImageScale::Fit f = ImageScale::fit(dec.w, dec.h);
+        CHECK(covers(f));
+        CHECK(edgesMapped(f));
+    }
+}
+
+// Feed a whole canvas-sized frame line by line, as GIFDraw would. The
+// marked edge is every source pixel whose centre lies in the last output
+// cell, which is what both filters should sample there.
+static void gifFrame(int cw, int ch, const ImageScale::Fit& f) {
+    int edgeX = (int)ceil((f.w - 1) * (double)cw / f.w - 0.5);
+    int edgeY = (int)ceil((f.h - 1) * (double)ch / f.h - 0.5);
+    std::vector<uint8_t> line(cw);
+    uint16_t palette[4] = { 0x0000, 0x1F00, 0x00F8, 0x1FF8 };   // big-endian: black, blue, red, both
+    for (int y = 0; y < ch; ++y) {
+        for (int x = 0; x < cw; ++x) line[x] = (x >= edgeX) | (y >= edgeY) << 1;
+        GIFDRAW d = {};
+        d.iWidth = cw;
+        d.iHeight = ch;
+        d.y = y;
+        d.pPixels = line.data();
+        d.pPalette = palette;
+        ImageScale::gifLine(&d);
+    }
+}
+
+TEST(gif_odd_sizes_map_last_column_and_row) {
+    for (auto filter : { ImageScale::Filter::Bilinear, ImageScale::Filter::Nearest }) {
+        for (auto wh : { std::make_pair(641, 401), std::make_pair(999, 173), std::make_pair(321, 999) }) {
+            clearPanel();
+            CHECK(ImageScale::gifBegin(wh.first, wh.second, filter));
+            ImageScale::Fit f = ImageScale::fit(wh.first, wh.second);
+            gifFrame(wh.first, wh.second, f);
+            CHECK(covers(f));
+            CHECK(edgesMapped(f));
+            ImageScale::gifEnd();
+        }
+    }
+    CHECK(PsramPool::stats().usedBytes == 0);
+}
+
+TEST(gif_that_fits_is_not_scaled) {
+    CHECK(!ImageScale::gifBegin(PW, PH - 1));
+    CHECK(!ImageScale::gifScaling());
+}
+
+TEST_MAIN()
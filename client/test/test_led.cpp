@@ -0,0 +1,70 @@
+// Brightness+gamma output table against a float reference
+#include "../led.h"
+#include "../ledfx.h"
+#include "harness.h"
+
+// The LED pin sees whatever the LUT produced; the sequencer is replaced by
+// a fixed colour so every input level can be driven directly.
+static uint8_t outR, outG, outB;
+extern "C" void neopixelWrite(uint8_t, uint8_t r, uint8_t g, uint8_t b) { outR = r; outG = g; outB = b; }
+
+static uint32_t fxColor = 0;
+uint32_t LedFx::evaluate(unsigned long) { return fxColor; }
+void LedFx::play(uint8_t, const Track&, unsigned long) {}
+void LedFx::stop(uint8_t) {}
+bool LedFx::active(uint8_t) { return true; }
+bool LedFx::playSpec(const String&, unsigned long) { return false; }
+void LedFx::makeStatic(Track&, uint32_t) {}
+void LedFx::makeBlink(Track&, uint32_t, uint16_t) {}
+void LedFx::makeBreathe(Track&, uint32_t, uint16_t) {}
+void LedFx::makeRainbow(Track&, uint16_t) {}
+void LedFx::makeHeartbeat(Track&, uint32_t, uint8_t) {}
+
+// Written to the pin (neopixelWrite takes G, R, B for this part)
+static uint8_t drive(uint8_t level, uint8_t brightness) {
+    fxColor = (uint32_t)level << 8;         // green channel
+    Led::setBrightness(brightness);         // forces a write
+    return outR;
+}
+
+TEST(led_lut_matches_float_reference) {
+    Led::begin();
+    int worst = 0;
+    for (int b = 0; b <= 255; ++b) {
+        for (int i = 0; i <= 255; ++i) {
+            float ref = powf(i / 255.0f, 2.2f) * b;
+            int got = drive(i, b);
+            // Rounded to the nearest count, off by at most the gamma16 quantum
+            CHECK(fabsf(got - ref) <= 0.5f + b / 65535.0f + 1e-4f);
+            int err = (int)lroundf(fabsf(got - ref) * 1000);
+            if (err > worst) worst = err;
+        }
+    }
+    CHECK(drive(0, 255) == 0);
+    CHECK(drive(255, 255) == 255);
+    printf("    worst |lut - ref| = %.3f\n", worst / 1000.0);
+}
+
+TEST(led_lut_is_monotonic) {
+    Led::begin();
+    for (int b : {1, 8, 64, 128, 255}) {
+        int prev = 0;
+        for (int i = 0; i <= 255; ++i) {
+            int v = drive(i, b);
+            CHECK(v >= prev);
+            prev = v;
+        }
+    }
+}
+
+TEST(led_channels_share_the_table) {
+    Led::begin();
+    fxColor = 0x4080C0;
+    Led::setBrightness(200);
+    uint8_t r = outG, g = outR, b = outB;   // undo the pin's G, R, B order
+    CHECK(r == drive(0x40, 200));
+    CHECK(g == drive(0x80, 200));
+    CHECK(b == drive(0xC0, 200));
+}
+
+TEST_MAIN()
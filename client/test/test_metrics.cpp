@@ -0,0 +1,120 @@
+// Metrics: bucket edges, the 64-bit sum carried across two 32-bit atomics
+// (also from several threads at once), and well-formed /metrics text
+#include "../metrics.h"
+#include "harness.h"
+#include <map>
+#include <thread>
+#include <vector>
+
+class StringOut : public Print {
+public:
+    std::string s;
+    size_t write(uint8_t c) override { s += (char)c; return 1; }
+};
+
+// Every sample line of the exposition, by its full name with labels
+static std::map<std::string, std::string> scrape() {
+    StringOut out;
+    Metrics::write(out);
+    std::map<std::string, std::string> v;
+    size_t p = 0, e;
+    for (; (e = out.s.find('\n', p)) != std::string::npos; p = e + 1) {
+        std::string line = out.s.substr(p, e - p);
+        if (line.empty() || line[0] == '#') continue;
+        size_t sp = line.rfind(' ');
+        v[line.substr(0, sp)] = line.substr(sp + 1);
+    }
+    CHECK(p == out.s.size());   // ends with a newline
+    return v;
+}
+
+TEST(metrics_buckets_are_le_and_cumulative) {
+    using Metrics::Hist;
+    Metrics::observe(Hist::PullMs, 5);      // on a bound: that bucket
+    Metrics::observe(Hist::PullMs, 6);
+    Metrics::observe(Hist::PullMs, 10000);
+    Metrics::observe(Hist::PullMs, 10001);  // past the last bound: +Inf only
+    Metrics::observe(Hist::PullMessages, 0);
+    auto v = scrape();
+    CHECK(v["lovebyte_pull_ms_bucket{le=\"5\"}"] == "1");
+    CHECK(v["lovebyte_pull_ms_bucket{le=\"10\"}"] == "2");
+    CHECK(v["lovebyte_pull_ms_bucket{le=\"5000\"}"] == "2");
+    CHECK(v["lovebyte_pull_ms_bucket{le=\"10000\"}"] == "3");
+    CHECK(v["lovebyte_pull_ms_bucket{le=\"+Inf\"}"] == "4");
+    CHECK(v["lovebyte_pull_ms_count"] == "4");
+    CHECK(v["lovebyte_pull_ms_sum"] == "20012");
+    CHECK(v["lovebyte_pull_messages_bucket{le=\"0\"}"] == "1");
+    CHECK(v["lovebyte_weather_fetch_ms_count"] == "0");
+}
+
+TEST(metrics_sum_carries_past_32_bits) {
+    using Metrics::Hist;
+    for (int i = 0; i < 3; ++i) Metrics::observe(Hist::SdWriteUs, 0xF0000000u);
+    CHECK(scrape()["lovebyte_sd_write_us_sum"] == std::to_string(3ull * 0xF0000000u));
+
+    // Concurrent writers each see their own wrap of the low word
+    const int THREADS = 4, EACH = 50000;
+    const uint32_t VALUE = 0x10000001u;
+    std::vector<std::thread> ts;
+    for (int t = 0; t < THREADS; ++t) {
+        ts.emplace_back([&] {
+            for (int i = 0; i < EACH; ++i) {
+                Metrics::observe(Hist::SdReadUs, VALUE);
+                Metrics::inc(Metrics::Counter::PullBytes, 3);
+            }
+        });
+    }
+    for (auto& t : ts) t.join();
+    auto v = scrape();
+    CHECK(v["lovebyte_sd_read_us_sum"] == std::to_string((unsigned long long)THREADS * EACH * VALUE));
+    CHECK(v["lovebyte_sd_read_us_count"] == std::to_string(THREADS * EACH));
+    CHECK(v["lovebyte_pull_bytes_total"] == std::to_string(THREADS * EACH * 3));
+}
+
+TEST(metrics_loop_tick_times_iterations) {
+    hostAdvanceMs(1);
+    Metrics::loopTick();                    // first call only starts the clock
+    hostMicros += 300;
+    Metrics::loopTick();
+    hostMicros += 40000;
+    Metrics::loopTick();
+    auto v = scrape();
+    CHECK(v["lovebyte_loop_us_count"] == "2");
+    CHECK(v["lovebyte_loop_us_bucket{le=\"250\"}"] == "0");
+    CHECK(v["lovebyte_loop_us_bucket{le=\"500\"}"] == "1");
+    CHECK(v["lovebyte_loop_us_bucket{le=\"50000\"}"] == "2");
+}
+
+TEST(metrics_exposition_is_well_formed) {
+    StringOut out;
+    Metrics::write(out);
+    // Each sample belongs to a metric whose TYPE line came first
+    std::map<std::string, std::string> types;
+    size_t p = 0, e, samples = 0;
+    for (; (e = out.s.find('\n', p)) != std::string::npos; p = e + 1) {
+        std::string line = out.s.substr(p, e - p);
+        if (!line.compare(0, 7, "# TYPE ")) {
+            size_t sp = line.find(' ', 7);
+            types[line.substr(7, sp - 7)] = line.substr(sp + 1);
+            continue;
+        }
+        if (line[0] == '#') continue;
+        std::string name = line.substr(0, line.find_first_of("{ "));
+        for (const char* suffix : { "_bucket", "_sum", "_count" }) {
+            size_t n = strlen(suffix);
+            if (!types.count(name) && name.size() > n && !name.compare(name.size() - n, n, suffix))
+                name.resize(name.size() - n);
+        }
+        CHECK(types.count(name));
+        char* end;
+        strtod(line.c_str() + line.rfind(' ') + 1, &end);
+        CHECK(*end == 0);
+        ++samples;
+    }
+    CHECK(types["lovebyte_pull_ms"] == "histogram");
+    CHECK(types["lovebyte_pulls_total"] == "counter");
+    CHECK(types["lovebyte_heap_largest_free_block_bytes"] == "gauge");
+    CHECK(samples > 100);
+}
+
+TEST_MAIN()
@@ -0,0 +1,129 @@
+// PsramPool: size classes, buddy merging back to one whole arena after a
+// long random workload, realloc, fallbacks and bad frees
+#include "../psram_pool.h"
+#include "harness.h"
+#include <random>
+#include <vector>
+
+static bool inArena(void* p, const PsramPool::Stats& s, void* base) {
+    return (uint8_t*)p >= (uint8_t*)base && (uint8_t*)p < (uint8_t*)base + s.arenaBytes;
+}
+
+// The first allocation of an empty pool is the arena's first block
+static uint8_t* arenaBase() {
+    void* p = PsramPool::alloc(1);
+    PsramPool::free(p);
+    return (uint8_t*)p;
+}
+
+static bool whole(const PsramPool::Stats& s) {
+    bool ok = s.usedBytes == 0 && s.requestedBytes == 0 && s.largestFree == s.arenaBytes;
+    for (int o = 0; o < PSRAM_POOL_ORDERS; ++o) ok &= s.freeBlocks[o] == (o == PSRAM_POOL_MAX_ORDER);
+    return ok;
+}
+
+TEST(pool_arena_from_half_of_psram) {
+    PsramPool::begin();
+    PsramPool::Stats s = PsramPool::stats();
+    // 8 MB PSRAM free: half of it, rounded down to a power of two
+    CHECK(s.arenaBytes == (size_t)PSRAM_POOL_MIN_BLOCK << PSRAM_POOL_MAX_ORDER);
+    CHECK(whole(s));
+    CHECK((uintptr_t)arenaBase() % PSRAM_POOL_MIN_BLOCK == 0);
+}
+
+TEST(pool_size_classes_and_fallback) {
+    PsramPool::Stats s0 = PsramPool::stats();
+    uint8_t* base = arenaBase();
+    void* a = PsramPool::alloc(1);
+    void* b = PsramPool::alloc(PSRAM_POOL_MIN_BLOCK + 1);
+    void* c = PsramPool::alloc(0);
+    PsramPool::Stats s = PsramPool::stats();
+    CHECK(s.usedBytes == PSRAM_POOL_MIN_BLOCK * 4);
+    CHECK(s.requestedBytes == PSRAM_POOL_MIN_BLOCK + 3);
+    CHECK(s.largestFree == s.arenaBytes / 2);
+
+    void* big = PsramPool::alloc(s.arenaBytes + 1);
+    CHECK(big && !inArena(big, s, base));
+    memset(big, 1, s.arenaBytes + 1);
+    CHECK(PsramPool::stats().fallbacks == s0.fallbacks + 1);
+    PsramPool::free(big);
+
+    PsramPool::free(b);
+    PsramPool::free(a);
+    PsramPool::free(c);
+    CHECK(whole(PsramPool::stats()));
+}
+
+TEST(pool_bad_free_is_ignored) {
+    void* a = PsramPool::alloc(100);
+    void* b = PsramPool::alloc(100);
+    PsramPool::free(a);
+    PsramPool::Stats s = PsramPool::stats();
+    PsramPool::free(a);                         // double free
+    PsramPool::free((uint8_t*)b + PSRAM_POOL_MIN_BLOCK / 2);   // into a block
+    PsramPool::Stats t = PsramPool::stats();
+    CHECK(t.usedBytes == s.usedBytes && t.frees == s.frees);
+    PsramPool::free(b);
+    CHECK(whole(PsramPool::stats()));
+}
+
+TEST(pool_realloc_keeps_contents) {
+    uint8_t* p = (uint8_t*)PsramPool::realloc(nullptr, 100);
+    for (int i = 0; i < 100; ++i) p[i] = i;
+    CHECK(PsramPool::realloc(p, 4000) == p);    // still fits its block
+    p = (uint8_t*)PsramPool::realloc(p, 50000);
+    bool same = true;
+    for (int i = 0; i < 100; ++i) same &= p[i] == i;
+    CHECK(same);
+    CHECK(PsramPool::stats().requestedBytes == 50000);
+    PsramPool::free(p);
+    CHECK(whole(PsramPool::stats()));
+}
+
+// Up to six image-sized buffers live at once, coming and going at random;
+// each block carries its own fill pattern, so an overlap shows up when it
+// is freed
+TEST(pool_random_workload_merges_back) {
+    struct Block { uint8_t* p; size_t n; uint8_t tag; };
+    std::mt19937 rng(1);
+    std::vector<Block> live;
+    bool intact = true;
+    uint32_t allocCalls = 0;
+    uint32_t minLargest = UINT32_MAX;
+    PsramPool::Stats s0 = PsramPool::stats();
+    for (int i = 0; i < 200000; ++i) {
+        if (live.empty() || (live.size() < 6 && rng() % 2)) {
+            size_t n = 1 + rng() % 300000;
+            uint8_t* p = (uint8_t*)PsramPool::alloc(n);
+            ++allocCalls;
+            memset(p, i & 255, n);
+            live.push_back({ p, n, (uint8_t)(i & 255) });
+        } else {
+            size_t k = rng() % live.size();
+            Block& b = live[k];
+            intact &= b.p[0] == b.tag && b.p[b.n / 2] == b.tag && b.p[b.n - 1] == b.tag;
+            PsramPool::free(b.p);
+            live[k] = live.back();
+            live.pop_back();
+        }
+        if (live.size() == 4) minLargest = std::min(minLargest, PsramPool::stats().largestFree);
+    }
+    for (Block& b : live) {
+        intact &= b.p[0] == b.tag && b.p[b.n - 1] == b.tag;
+        PsramPool::free(b.p);
+    }
+    PsramPool::Stats s = PsramPool::stats();
+    printf("    200000 ops: high water %u KB of %u KB, %u fallbacks, "
+           "smallest largest-free with 4 blocks live %u KB\n",
+           (unsigned)(s.highWater / 1024), (unsigned)(s.arenaBytes / 1024),
+           (unsigned)(s.fallbacks - s0.fallbacks), (unsigned)(minLargest / 1024));
+    CHECK(intact);
+    CHECK(whole(s));
+    CHECK(s.allocs - s0.allocs + s.fallbacks - s0.fallbacks == allocCalls);
+    CHECK(s.frees - s0.frees == s.allocs - s0.allocs);
+    // Four live blocks of at most 512 KB, even one per 1 MB quarter, leave
+    // a whole 512 KB buddy free
+    CHECK(minLargest >= s.arenaBytes / 8);
+}
+
+TEST_MAIN()
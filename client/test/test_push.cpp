@@ -0,0 +1,237 @@
+// /api/push under load: bodies from several connections arriving in
+// interleaved chunks, handed to the Outbound worker and POSTed to a slow
+// stand-in server on localhost, while the handler answers at once
+#include "../web_message.h"
+#include "../outbound.h"
+#include "../endpoint.h"
+#include "../config.h"
+#include "../web_assets.h"
+#include "harness.h"
+#include <Preferences.h>
+#include <chrono>
+#include <map>
+#include <memory>
+#include <set>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+using Clock = std::chrono::steady_clock;
+
+// The messenger page itself isn't under test
+void serveAsset(AsyncWebServerRequest* request, const WebAsset&) { request->send(200); }
+const WebAsset ASSET_CLOUD_HTML = { "text/html", nullptr, 0, "\"x\"" };
+
+static double usSince(Clock::time_point t0) {
+    return std::chrono::duration<double, std::micro>(Clock::now() - t0).count();
+}
+
+// --- Stand-in LoveByte server: one connection at a time, like Flask's
+// dev server, each answered after delayMs ---
+struct StandIn {
+    int fd = -1;
+    uint16_t port = 0;
+    unsigned delayMs = 0;
+    std::mutex m;
+    std::multiset<std::string> bodies;
+
+    void start(unsigned delay) {
+        delayMs = delay;
+        fd = socket(AF_INET, SOCK_STREAM, 0);
+        sockaddr_in a = {};
+        a.sin_family = AF_INET;
+        a.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        socklen_t len = sizeof(a);
+        bind(fd, (sockaddr*)&a, len);
+        listen(fd, 16);
+        getsockname(fd, (sockaddr*)&a, &len);
+        port = ntohs(a.sin_port);
+        std::thread([this] {
+            for (int c; (c = accept(fd, nullptr, nullptr)) >= 0; close(c)) serve(c);
+        }).detach();
+    }
+
+    void serve(int c) {
+        std::string in;
+        char buf[2048];
+        size_t end;
+        ssize_t n;
+        while ((end = in.find("\r\n\r\n")) == std::string::npos && (n = recv(c, buf, sizeof(buf), 0)) > 0) in.append(buf, n);
+        if (end == std::string::npos) return;
+        size_t cl = in.find("Content-Length: ");
+        size_t want = cl == std::string::npos ? 0 : strtoul(in.c_str() + cl + 16, nullptr, 10);
+        std::string body = in.substr(end + 4);
+        while (body.size() < want && (n = recv(c, buf, sizeof(buf), 0)) > 0) body.append(buf, n);
+        std::this_thread::sleep_for(std::chrono::milliseconds(delayMs));
+        { std::lock_guard<std::mutex> l(m); bodies.insert(body); }
+        std::string reply = "{\"status\":\"ok\",\"bytes\":" + std::to_string(body.size()) + "}";
+        std::string resp = "HTTP/1.1 200 OK\r\nContent-Type: application/json\r\nContent-Length: " +
+                           std::to_string(reply.size()) + "\r\nConnection: close\r\n\r\n" + reply;
+        send(c, resp.data(), resp.size(), MSG_NOSIGNAL);
+    }
+};
+
+static AsyncWebServer server;
+
+static const AsyncWebServer::Route* route(const char* uri, int method) {
+    if (server.routes.empty()) {
+        Preferences::reset();
+        Config::begin();
+        Outbound::begin();
+        setupMessagePageRoutes(server);
+    }
+    return server.find(uri, method);
+}
+
+static void useServer(uint16_t port) {
+    Config::lock();
+    Config::get().serverAddress = ("127.0.0.1:" + std::to_string(port)).c_str();
+    Config::get().deviceName = "load";
+    Config::unlock();
+    Endpoint::update();
+}
+
+// Job state as the messenger page sees it through /api/push/result
+static std::string poll(uint32_t job) {
+    AsyncWebServerRequest req;
+    req.addParam("job", String(std::to_string(job)));
+    route("/api/push/result", HTTP_GET)->onRequest(&req);
+    return req.sent->drain();
+}
+
+static std::string waitDone(uint32_t job) {
+    std::string r;
+    for (int i = 0; i < 5000; ++i) {
+        r = poll(job);
+        if (r.find("\"pending\"") == std::string::npos) break;
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    }
+    return r;
+}
+
+struct Push {
+    std::string body;
+    AsyncWebServerRequest req;
+    int code = 0;
+    uint32_t job = 0;
+};
+
+// Deliver the bodies in MSS-sized chunks, round-robin across connections as
+// AsyncTCP would, then run each request handler. Returns the slowest
+// handler call in microseconds.
+static double deliver(std::vector<std::unique_ptr<Push>>& pushes, size_t mss = 536) {
+    const AsyncWebServer::Route* r = route("/api/push", HTTP_POST);
+    double worst = 0;
+    for (size_t off = 0;; off += mss) {
+        bool any = false;
+        for (auto& p : pushes) {
+            size_t total = p->body.size();
+            if (off >= total) continue;     // an empty body never reaches onBody
+            size_t len = std::min(mss, total - off);
+            Clock::time_point t0 = Clock::now();
+            r->onBody(&p->req, (uint8_t*)&p->body[off], len, off, total);
+            worst = std::max(worst, usSince(t0));
+            any = true;
+        }
+        if (!any) break;
+    }
+    for (auto& p : pushes) {
+        Clock::time_point t0 = Clock::now();
+        r->onRequest(&p->req);
+        worst = std::max(worst, usSince(t0));
+        p->code = p->req.sent->code;
+        std::string reply = p->req.sent->drain();
+        if (p->code == 202) sscanf(reply.c_str(), "{\"status\":\"accepted\",\"job\":%u}", &p->job);
+    }
+    return worst;
+}
+
+static std::string message(unsigned i, size_t len) {
+    std::string s = "{\"device_id\":\"load\",\"text\":\"#" + std::to_string(i) + " ";
+    while (s.size() + 2 < len) s += (char)('a' + (s.size() * 7 + i) % 26);
+    return s + "\"}";
+}
+
+TEST(push_load_against_slow_server) {
+    const unsigned ROUNDS = 25, CONNS = 8, DELAY_MS = 40;
+    static StandIn standIn;
+    standIn.start(DELAY_MS);
+    route("/api/push", HTTP_POST);
+    useServer(standIn.port);
+
+    std::multiset<std::string> accepted;
+    unsigned rejected = 0, done = 0;
+    double worst = 0;
+    Clock::time_point t0 = Clock::now();
+    for (unsigned round = 0; round < ROUNDS; ++round) {
+        std::vector<std::unique_ptr<Push>> pushes;
+        for (unsigned c = 0; c < CONNS; ++c) {
+            pushes.emplace_back(new Push());
+            pushes.back()->body = message(round * CONNS + c, 200 + (round * 977 + c * 463) % 3800);
+        }
+        worst = std::max(worst, deliver(pushes));
+        for (auto& p : pushes) {
+            CHECK(p->code == 202 || p->code == 503);
+            if (p->code == 202) accepted.insert(p->body);
+            else ++rejected;
+        }
+        for (auto& p : pushes) {
+            if (p->code != 202) continue;
+            std::string r = waitDone(p->job);
+            bool ok = r.find("\"state\":\"done\",\"code\":200") != std::string::npos &&
+                      r.find("\\\"bytes\\\":" + std::to_string(p->body.size()) + "}") != std::string::npos;
+            CHECK(ok);
+            done += ok;
+        }
+    }
+    double wall = usSince(t0) / 1000;
+    printf("    %u pushes from %u connections: %zu accepted, %u queue-full 503s\n",
+           ROUNDS * CONNS, CONNS, accepted.size(), rejected);
+    printf("    slowest handler call %.0f us; server takes %u ms per POST; %u done in %.0f ms\n",
+           worst, DELAY_MS, done, wall);
+
+    // The worker holds its job's slot during the POST (and reports it done
+    // just before letting go), so each burst gets the ring's 3 or 4 free
+    // slots and the rest are turned away rather than waited on
+    CHECK(accepted.size() >= ROUNDS * (OUTBOUND_QUEUE - 1) && accepted.size() <= ROUNDS * OUTBOUND_QUEUE);
+    CHECK(done == accepted.size());
+    CHECK(worst < DELAY_MS * 1000 / 4);
+    std::lock_guard<std::mutex> l(standIn.m);
+    CHECK(standIn.bodies == accepted);
+}
+
+TEST(push_server_down_fails_the_job) {
+    int fd = socket(AF_INET, SOCK_STREAM, 0);
+    sockaddr_in a = {};
+    a.sin_family = AF_INET;
+    a.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    socklen_t len = sizeof(a);
+    bind(fd, (sockaddr*)&a, len);
+    getsockname(fd, (sockaddr*)&a, &len);
+    close(fd);      // nothing listens there now
+    route("/api/push", HTTP_POST);
+    useServer(ntohs(a.sin_port));
+
+    std::vector<std::unique_ptr<Push>> pushes;
+    pushes.emplace_back(new Push());
+    pushes[0]->body = message(0, 100);
+    deliver(pushes);
+    CHECK(pushes[0]->code == 202);
+    std::string r = waitDone(pushes[0]->job);
+    CHECK(r.find("\"state\":\"failed\",\"code\":-1,\"reply\":\"connection refused\"") != std::string::npos);
+    CHECK(poll(pushes[0]->job + 100).find("\"unknown\"") != std::string::npos);
+}
+
+TEST(push_body_limits) {
+    std::vector<std::unique_ptr<Push>> pushes;
+    for (size_t len : { (size_t)0, (size_t)OUTBOUND_BODY_MAX + 1 }) {
+        pushes.emplace_back(new Push());
+        pushes.back()->body = std::string(len, 'x');
+    }
+    deliver(pushes);
+    CHECK(pushes[0]->code == 400);
+    CHECK(pushes[1]->code == 413);
+}
+
+TEST_MAIN()
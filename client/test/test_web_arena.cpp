@@ -0,0 +1,104 @@
+// WebArena: bytes out exactly as written whatever size the server pulls
+// them in, slabs back in the pool once the response goes, heap fallback
+// when the pool is dry and a hard stop at WEB_ARENA_MAX_SLABS
+#include "../web_arena.h"
+#include "harness.h"
+#include <map>
+#include <memory>
+#include <vector>
+
+class StringOut : public Print {
+public:
+    std::string s;
+    size_t write(uint8_t c) override { s += (char)c; return 1; }
+};
+
+static unsigned gauge(const char* name) {
+    StringOut out;
+    WebArena::writeMetrics(out);
+    size_t p = out.s.find(std::string("\n") + name + " ");
+    return p == std::string::npos ? ~0u : (unsigned)strtoul(out.s.c_str() + p + strlen(name) + 2, nullptr, 10);
+}
+
+TEST(arena_bytes_exact_across_chunk_sizes) {
+    for (size_t total : { (size_t)0, (size_t)1, (size_t)900, (size_t)1024, (size_t)3000, (size_t)7000 }) {
+        std::string want;
+        WebArena* a = WebArena::create();
+        for (size_t i = 0; want.size() < total; ++i) {
+            char piece[64];
+            int n = snprintf(piece, sizeof(piece), "<p>%zu:%s</p>\n", i, std::string(i % 37, 'a' + i % 26).c_str());
+            if (want.size() + n > total) n = total - want.size();
+            a->write((const uint8_t*)piece, n);
+            want.append(piece, n);
+        }
+        CHECK(a->length() == want.size());
+        auto* req = new AsyncWebServerRequest();
+        a->send(req, 200, "text/html");
+        CHECK(req->sent->length == want.size() && req->sent->code == 200);
+        for (size_t chunk : { 1, 7, 536, 1436, 8192 }) CHECK(req->sent->drain(chunk) == want);
+        delete req;
+    }
+    CHECK(gauge("lovebyte_web_arena_slabs_in_use") == 0);
+}
+
+TEST(arena_html_and_printf) {
+    WebArena* a = WebArena::create();
+    a->printf("{\"job\":%u}", 42u);
+    a->html("<a href='x'>\"Tom & Jerry\"</a>");
+    auto* req = new AsyncWebServerRequest();
+    a->send(req, 202, "application/json");
+    CHECK(req->sent->drain() ==
+          "{\"job\":42}&lt;a href=&#39;x&#39;&gt;&quot;Tom &amp; Jerry&quot;&lt;/a&gt;");
+    delete req;
+}
+
+TEST(arena_slabs_return_when_response_dropped) {
+    auto* req = new AsyncWebServerRequest();
+    WebArena* a = WebArena::create();
+    std::string big(2500, 'x');
+    a->print(big.c_str());
+    CHECK(gauge("lovebyte_web_arena_slabs_in_use") == 3);
+    a->send(req, 200, "text/plain");
+    // The filler may be copied around by the server; the slabs stay until
+    // the last copy goes with the response
+    AwsResponseFiller copy = req->sent->filler;
+    CHECK(gauge("lovebyte_web_arena_slabs_in_use") == 3);
+    delete req;
+    CHECK(gauge("lovebyte_web_arena_slabs_in_use") == 3);
+    copy = nullptr;
+    CHECK(gauge("lovebyte_web_arena_slabs_in_use") == 0);
+}
+
+TEST(arena_pool_dry_falls_back_to_heap) {
+    unsigned heap0 = gauge("lovebyte_web_arena_heap_slabs_total");
+    std::vector<std::unique_ptr<AsyncWebServerRequest>> held;
+    for (int i = 0; i < WEB_ARENA_POOL + 2; ++i) {
+        WebArena* a = WebArena::create();
+        CHECK(a);
+        a->printf("%d", i);
+        held.emplace_back(new AsyncWebServerRequest());
+        a->send(held.back().get(), 200, "text/plain");
+    }
+    CHECK(gauge("lovebyte_web_arena_slabs_in_use") == WEB_ARENA_POOL + 2);
+    CHECK(gauge("lovebyte_web_arena_heap_slabs_total") == heap0 + 2);
+    CHECK(held[WEB_ARENA_POOL + 1]->sent->drain() == std::to_string(WEB_ARENA_POOL + 1));
+    held.clear();
+    CHECK(gauge("lovebyte_web_arena_slabs_in_use") == 0);
+}
+
+TEST(arena_overflow_stops_at_max_slabs) {
+    unsigned over0 = gauge("lovebyte_web_arena_overflows_total");
+    WebArena* a = WebArena::create();
+    std::string big(WEB_ARENA_SLAB * (WEB_ARENA_MAX_SLABS + 1), 'y');
+    size_t n = a->print(big.c_str());
+    CHECK(n < big.size() && n == a->length());
+    CHECK(n > WEB_ARENA_SLAB * (WEB_ARENA_MAX_SLABS - 1));
+    CHECK(gauge("lovebyte_web_arena_overflows_total") == over0 + 1);
+    auto* req = new AsyncWebServerRequest();
+    a->send(req, 200, "text/plain");
+    CHECK(req->sent->drain(1436) == big.substr(0, n));
+    delete req;
+    CHECK(gauge("lovebyte_web_arena_slabs_in_use") == 0);
+}
+
+TEST_MAIN()
@@ -0,0 +1,255 @@
+#include "thumbs.h"
+#include "sd_stats.h"
+#include "psram_pool.h"
+#include <SD_MMC.h>
+#include <JPEGDEC.h>
+#include <AnimatedGIF.h>
+#include <esp_heap_caps.h>
+#include <new>
+
+#define THUMB_NAME_MAX  64
+#define THUMB_FAILED    8
+
+// Pending and failed names, shared between web handlers and loop()
+static portMUX_TYPE mux = portMUX_INITIALIZER_UNLOCKED;
+static char pending[THUMB_QUEUE][THUMB_NAME_MAX];
+static uint8_t pendingCount = 0;
+static char failedNames[THUMB_FAILED][THUMB_NAME_MAX];
+static uint8_t failedNext = 0;
+
+// Decoders are large; they live in PSRAM and are only created on first use
+static JPEGDEC* jdec = nullptr;
+static AnimatedGIF* gdec = nullptr;
+
+// Output being sampled into by the decoder callbacks (loop only)
+struct ThumbTarget {
+    uint16_t* px;           // tw*th RGB565 little-endian
+    int tw, th;             // thumbnail size
+    int sw, sh;             // decoded (post-DCT-scale) source size
+};
+static ThumbTarget target;
+
+template <typename T>
+static T* psNew() {
+    void* p = heap_caps_malloc(sizeof(T), MALLOC_CAP_SPIRAM);
+    if (!p) p = malloc(sizeof(T));
+    return p ? new (p) T() : nullptr;
+}
+
+static void fitThumb(int w, int h, int& tw, int& th) {
+    int longest = w > h ? w : h;
+    if (longest <= THUMB_MAX) { tw = w; th = h; return; }
+    tw = (w * THUMB_MAX) / longest;
+    th = (h * THUMB_MAX) / longest;
+    if (tw < 1) tw = 1;
+    if (th < 1) th = 1;
+}
+
+// Nearest-neighbour: copy the target pixels whose source lands in this block
+static int thumbJpegDraw(JPEGDRAW* d) {
+    ThumbTarget& t = target;
+    int ty = (d->y * t.th + t.sh - 1) / t.sh;
+    for (; ty < t.th; ++ty) {
+        int sy = ty * t.sh / t.th;
+        if (sy >= d->y + d->iHeight) break;
+        const uint16_t* srcRow = d->pPixels + (sy - d->y) * d->iWidth;
+        int tx = (d->x * t.tw + t.sw - 1) / t.sw;
+        for (; tx < t.tw; ++tx) {
+            int sx = tx * t.sw / t.tw;
+            if (sx >= d->x + d->iWidth) break;
+            t.px[ty * t.tw + tx] = srcRow[sx - d->x];
+        }
+    }
+    return 1;
+}
+
+static void thumbGifDraw(GIFDRAW* d) {
+    ThumbTarget& t = target;
+    int y = d->iY + d->y;
+    int ty = (y * t.th + t.sh - 1) / t.sh;
+    if (ty >= t.th || ty * t.sh / t.th != y) return;    // row not sampled
+    uint16_t* dst = t.px + ty * t.tw;
+    for (int tx = (d->iX * t.tw + t.sw - 1) / t.sw; tx < t.tw; ++tx) {
+        int sx = tx * t.sw / t.tw;
+        if (sx >= d->iX + d->iWidth) break;
+        uint8_t c = d->pPixels[sx - d->iX];
+        if (d->ucHasTransparency && c == d->ucTransparent) continue;
+        dst[tx] = d->pPalette[c];
+    }
+}
+
+static bool makeJpeg(uint8_t* buf, size_t len) {
+    if (!jdec && !(jdec = psNew<JPEGDEC>())) return false;
+    if (!jdec->openRAM(buf, len, thumbJpegDraw)) return false;
+    int w = jdec->getWidth(), h = jdec->getHeight();
+    int longest = w > h ? w : h;
+    // Let the IDCT do the bulk of the reduction, keeping at least THUMB_MAX px
+    int scale = 1, opt = 0;
+    if (longest >= THUMB_MAX * 8)      { scale = 8; opt = JPEG_SCALE_EIGHTH; }
+    else if (longest >= THUMB_MAX * 4) { scale = 4; opt = JPEG_SCALE_QUARTER; }
+    else if (longest >= THUMB_MAX * 2) { scale = 2; opt = JPEG_SCALE_HALF; }
+    target.sw = w / scale;
+    target.sh = h / scale;
+    fitThumb(target.sw, target.sh, target.tw, target.th);
+    target.px = (uint16_t*)PsramPool::alloc(target.tw * target.th * 2);
+    if (!target.px) { jdec->close(); return false; }
+    memset(target.px, 0, target.tw * target.th * 2);
+    jdec->setPixelType(RGB565_LITTLE_ENDIAN);
+    bool ok = jdec->decode(0, 0, opt);
+    jdec->close();
+    return ok;
+}
+
+static bool makeGif(uint8_t* buf, size_t len) {
+    if (!gdec && !(gdec = psNew<AnimatedGIF>())) return false;
+    gdec->begin(GIF_PALETTE_RGB565_LE);
+    if (!gdec->open(buf, len, thumbGifDraw)) return false;
+    target.sw = gdec->getCanvasWidth();
+    target.sh = gdec->getCanvasHeight();
+    fitThumb(target.sw, target.sh, target.tw, target.th);
+    target.px = (uint16_t*)PsramPool::alloc(target.tw * target.th * 2);
+    if (!target.px) { gdec->close(); return false; }
+    memset(target.px, 0, target.tw * target.th * 2);
+    gdec->playFrame(false, nullptr);
+    gdec->close();
+    return true;
+}
+
+static void put16(uint8_t* p, uint16_t v) { p[0] = v; p[1] = v >> 8; }
+static void put32(uint8_t* p, uint32_t v) { put16(p, v); put16(p + 2, v >> 16); }
+
+// 16-bit BI_BITFIELDS (RGB565) BMP, bottom-up rows padded to 4 bytes
+static bool writeBmp(const String& path, const ThumbTarget& t) {
+    const uint32_t rowBytes = (t.tw * 2 + 3) & ~3u;
+    const uint32_t dataOffset = 14 + 40 + 12;
+    uint8_t hdr[dataOffset] = {0};
+    hdr[0] = 'B'; hdr[1] = 'M';
+    put32(hdr + 2, dataOffset + rowBytes * t.th);
+    put32(hdr + 10, dataOffset);
+    put32(hdr + 14, 40);
+    put32(hdr + 18, t.tw);
+    put32(hdr + 22, t.th);
+    put16(hdr + 26, 1);
+    put16(hdr + 28, 16);
+    put32(hdr + 30, 3);                 // BI_BITFIELDS
+    put32(hdr + 34, rowBytes * t.th);
+    put32(hdr + 54, 0xF800);
+    put32(hdr + 58, 0x07E0);
+    put32(hdr + 62, 0x001F);
+
+    String tmp = path + ".tmp";
+    File f = SD_MMC.open(tmp, FILE_WRITE);
+    if (!f) return false;
+    bool ok = f.write(hdr, sizeof(hdr)) == sizeof(hdr);
+    static const uint8_t pad[4] = {0};
+    for (int y = t.th - 1; ok && y >= 0; --y) {
+        ok = f.write((const uint8_t*)(t.px + y * t.tw), t.tw * 2) == (size_t)t.tw * 2;
+        if (ok && rowBytes > (uint32_t)t.tw * 2) f.write(pad, rowBytes - t.tw * 2);
+    }
+    f.close();
+    SdStats::added(dataOffset + rowBytes * t.th);
+    // Renamed into place so the web server never sees a half-written file
+    if (ok) {
+        SdStats::remove(path);
+        ok = SD_MMC.rename(tmp, path);
+    }
+    if (!ok) SdStats::remove(tmp);
+    return ok;
+}
+
+static bool generate(const String& name) {
+    String dst = Thumbs::pathFor(name);
+    if (SD_MMC.exists(dst)) return true;
+
+    unsigned long t0 = millis();
+    File f = SD_MMC.open("/images/" + name, FILE_READ);
+    if (!f || f.isDirectory() || f.size() == 0 || f.size() > THUMB_SRC_MAX) {
+        if (f) f.close();
+        return false;
+    }
+    size_t len = f.size();
+    uint8_t* buf = (uint8_t*)PsramPool::alloc(len);
+    if (!buf) { f.close(); return false; }
+    len = f.read(buf, len);
+    f.close();
+
+    String lower = name;
+    lower.toLowerCase();
+    target.px = nullptr;
+    bool ok = lower.endsWith(".gif") ? makeGif(buf, len) : makeJpeg(buf, len);
+    PsramPool::free(buf);
+    if (ok) ok = writeBmp(dst, target);
+    PsramPool::free(target.px);
+    target.px = nullptr;
+
+    Serial.printf("[Thumbs] %s: %s %dx%d in %lu ms\n", name.c_str(), ok ? "made" : "FAILED",
+        target.tw, target.th, millis() - t0);
+    return ok;
+}
+
+static void markFailed(const char* name) {
+    portENTER_CRITICAL(&mux);
+    strlcpy(failedNames[failedNext], name, THUMB_NAME_MAX);
+    failedNext = (failedNext + 1) % THUMB_FAILED;
+    portEXIT_CRITICAL(&mux);
+}
+
+String Thumbs::pathFor(const String& name) {
+    return String(THUMB_DIR) + "/" + name + ".bmp";
+}
+
+void Thumbs::begin() {
+    if (!SD_MMC.exists(THUMB_DIR)) SD_MMC.mkdir(THUMB_DIR);
+}
+
+bool Thumbs::failed(const String& name) {
+    bool hit = false;
+    portENTER_CRITICAL(&mux);
+    for (int i = 0; i < THUMB_FAILED && !hit; ++i) hit = !strcmp(failedNames[i], name.c_str());
+    portEXIT_CRITICAL(&mux);
+    return hit;
+}
+
+bool Thumbs::request(const String& name) {
+    if (name.length() >= THUMB_NAME_MAX || failed(name)) return false;
+    bool ok = true;
+    portENTER_CRITICAL(&mux);
+    bool queued = false;
+    for (int i = 0; i < pendingCount && !queued; ++i) queued = !strcmp(pending[i], name.c_str());
+    if (!queued) {
+        if (pendingCount < THUMB_QUEUE) strlcpy(pending[pendingCount++], name.c_str(), THUMB_NAME_MAX);
+        else ok = false;
+    }
+    portEXIT_CRITICAL(&mux);
+    return ok;
+}
+
+void Thumbs::invalidate(const String& name) {
+    String p = pathFor(name);
+    if (SD_MMC.exists(p)) SdStats::remove(p);
+    // A replaced image gets another chance
+    portENTER_CRITICAL(&mux);
+    for (int i = 0; i < THUMB_FAILED; ++i) {
+        if (!strcmp(failedNames[i], name.c_str())) failedNames[i][0] = 0;
+    }
+    portEXIT_CRITICAL(&mux);
+}
+
+void Thumbs::loop() {
+    char name[THUMB_NAME_MAX];
+    portENTER_CRITICAL(&mux);
+    if (!pendingCount) {
+        portEXIT_CRITICAL(&mux);
+        return;
+    }
+    strlcpy(name, pending[0], sizeof(name));
+    portEXIT_CRITICAL(&mux);
+
+    if (!generate(name)) markFailed(name);
+
+    // Only drop it once done, so request() keeps deduplicating meanwhile
+    portENTER_CRITICAL(&mux);
+    memmove(pending[0], pending[1], (pendingCount - 1) * THUMB_NAME_MAX);
+    pendingCount--;
+    portEXIT_CRITICAL(&mux);
+}
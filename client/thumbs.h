@@ -0,0 +1,30 @@
+// thumbs.h
+#pragma once
+
+#include <Arduino.h>
+
+// Small BMP previews of /images for the gallery and file manager, kept in
+// /images/.thumbs. Web handlers ask for one with request(); loop() makes them
+// one at a time (JPEG through the decoder's 1/2..1/8 DCT scaling, GIF from
+// the first frame) and the server then hands out the file as immutable.
+
+#define THUMB_DIR       "/images/.thumbs"
+#define THUMB_MAX       96                  // longest side, px
+#define THUMB_QUEUE     16
+#define THUMB_SRC_MAX   (4 * 1024 * 1024)   // larger sources are skipped
+
+namespace Thumbs {
+    void begin();
+    void loop();    // call from loop(): makes at most one pending thumbnail
+
+    // THUMB_DIR/<name>.bmp for a file name in /images
+    String pathFor(const String& name);
+
+    // Queue a thumbnail for generation. Safe from any task; duplicates are
+    // ignored. Returns false if the queue is full or the image can't be done.
+    bool request(const String& name);
+    bool failed(const String& name);
+
+    // Drop the thumbnail of a removed or replaced image (loop only)
+    void invalidate(const String& name);
+}
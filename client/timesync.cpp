@@ -0,0 +1,125 @@
+#include "timesync.h"
+#include "config.h"
+#include "boot_profile.h"
+#include <esp_attr.h>
+#include <esp_sntp.h>
+#include <sys/time.h>
+#include <time.h>
+#include <atomic>
+#if CONFIG_IDF_TARGET_ESP32S3
+#include <esp32s3/rtc.h>
+#else
+#include <esp32/rtc.h>
+#endif
+
+#define TIME_MAGIC  0x4C42544DUL    // "LBTM"
+
+// Survives soft reset and deep sleep, garbage after power-on (hence the check)
+struct TimeSnap {
+    uint32_t magic;
+    int64_t epochUs;    // wall clock when taken
+    uint64_t rtcUs;     // RTC timer when taken; it keeps running across resets
+    uint32_t check;
+};
+RTC_NOINIT_ATTR static TimeSnap snap;
+
+static int tzOffset = 0;
+static bool started = false;
+static bool everSynced = false;
+static unsigned long startedAt = 0;
+static unsigned long lastSnap = 0;
+static std::atomic<bool> syncPending{false};
+
+static uint32_t snapCheck(const TimeSnap& s) {
+    return s.magic ^ (uint32_t)s.epochUs ^ (uint32_t)(s.epochUs >> 32) ^
+           (uint32_t)s.rtcUs ^ (uint32_t)(s.rtcUs >> 32) ^ 0xA5A5A5A5UL;
+}
+
+static void takeSnapshot() {
+    struct timeval tv;
+    gettimeofday(&tv, nullptr);
+    if (tv.tv_sec < TIME_VALID_AFTER) return;
+    snap.magic = TIME_MAGIC;
+    snap.epochUs = (int64_t)tv.tv_sec * 1000000 + tv.tv_usec;
+    snap.rtcUs = esp_rtc_get_time_us();
+    snap.check = snapCheck(snap);
+    lastSnap = millis();
+}
+
+static void restoreSnapshot() {
+    if (time(nullptr) >= TIME_VALID_AFTER) return;      // IDF kept it already
+    if (snap.magic != TIME_MAGIC || snap.check != snapCheck(snap)) return;
+    uint64_t rtcNow = esp_rtc_get_time_us();
+    if (rtcNow < snap.rtcUs) return;                    // RTC was reset after all
+    int64_t us = snap.epochUs + (int64_t)(rtcNow - snap.rtcUs);
+    struct timeval tv = { (time_t)(us / 1000000), (suseconds_t)(us % 1000000) };
+    settimeofday(&tv, nullptr);
+    Serial.printf("[Time] Restored from RTC memory (%lu s since the snapshot)\n",
+        (unsigned long)((rtcNow - snap.rtcUs) / 1000000));
+}
+
+// lwIP task: just flag it, loop() does the rest
+static void onSync(struct timeval*) {
+    syncPending = true;
+}
+
+// POSIX TZ strings count west as positive, hence the flipped sign
+static void applyTz() {
+    char tz[16];
+    int off = -tzOffset;
+    snprintf(tz, sizeof(tz), "UTC%c%d:%02d", off < 0 ? '-' : '+', abs(off) / 3600, (abs(off) % 3600) / 60);
+    setenv("TZ", tz, 1);
+    tzset();
+}
+
+void TimeSync::begin(int tzOffsetSec) {
+    tzOffset = tzOffsetSec;
+    applyTz();
+    restoreSnapshot();
+}
+
+void TimeSync::start() {
+    if (started) return;
+    started = true;
+    startedAt = millis();
+    sntp_set_time_sync_notification_cb(onSync);
+    sntp_set_sync_interval(TIME_RESYNC_MS);
+    configTime(tzOffset, 0, TIME_NTP_SERVER);
+}
+
+void TimeSync::loop() {
+    if (syncPending.exchange(false)) {
+        takeSnapshot();
+        struct tm tm;
+        time_t now = time(nullptr);
+        localtime_r(&now, &tm);
+        char buf[32];
+        strftime(buf, sizeof(buf), "%Y-%m-%d %H:%M:%S", &tm);
+        Serial.printf("[Time] NTP sync: %s\n", buf);
+        Config::setNtpTime(buf);
+        if (!everSynced) BootProfile::span("ntp", millis() - startedAt);
+        everSynced = true;
+    } else if (millis() - lastSnap >= TIME_SNAPSHOT_MS) {
+        takeSnapshot();
+        lastSnap = millis();    // also paces retries while the clock is unset
+    }
+}
+
+void TimeSync::setTimezone(int tzOffsetSec) {
+    if (tzOffsetSec == tzOffset) return;
+    tzOffset = tzOffsetSec;
+    applyTz();
+}
+
+void TimeSync::resync() {
+    if (!started) return;
+    sntp_restart();
+}
+
+bool TimeSync::valid() {
+    return time(nullptr) >= TIME_VALID_AFTER;
+}
+
+bool TimeSync::synced() {
+    return everSynced;
+}
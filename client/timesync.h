@@ -0,0 +1,30 @@
+// timesync.h
+#pragma once
+
+#include <Arduino.h>
+
+// Wall-clock time without blocking anyone. SNTP runs in the background and
+// reports through its sync callback; lwIP repeats the sync every
+// TIME_RESYNC_MS. The time is also mirrored into RTC memory, so after a soft
+// reboot or deep sleep the clock is set again before Wi-Fi is even up.
+
+#define TIME_NTP_SERVER     "pool.ntp.org"
+#define TIME_RESYNC_MS      (3UL * 3600 * 1000)
+#define TIME_SNAPSHOT_MS    60000       // RTC mirror refresh; bounds RC-clock drift
+#define TIME_VALID_AFTER    1577836800  // 2020-01-01: anything earlier is unset
+
+namespace TimeSync {
+    // Restore the clock from RTC memory (if it survived) and apply the
+    // timezone. Call early in setup(), before anything stamps a time.
+    void begin(int tzOffsetSec);
+
+    // Start SNTP once there is a network; harmless to call again
+    void start();
+    void loop();
+
+    void setTimezone(int tzOffsetSec);
+    void resync();      // ask for a sync now (non-blocking)
+
+    bool valid();       // clock is set (restored or synced)
+    bool synced();      // synced by NTP during this boot
+}
@@ -0,0 +1,69 @@
+#!/usr/bin/env python3
+"""Gzip the files in www/ and embed them as web_assets.h / web_assets.cpp.
+
+Run from the client/ directory (or anywhere) after editing a page:
+
+    python3 tools/embed_web.py
+
+Each asset gets a strong ETag derived from its contents, so browsers
+revalidate with If-None-Match and get a 304 when nothing changed.
+"""
+import gzip
+import hashlib
+import os
+import re
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+CLIENT = os.path.dirname(HERE)
+WWW = os.path.join(CLIENT, "www")
+
+MIME = {
+    ".html": "text/html",
+    ".css": "text/css",
+    ".js": "application/javascript",
+    ".json": "application/json",
+    ".svg": "image/svg+xml",
+}
+
+
+def ident(name):
+    return "ASSET_" + re.sub(r"[^A-Za-z0-9]", "_", name).upper()
+
+
+def main():
+    assets = []
+    for name in sorted(os.listdir(WWW)):
+        ext = os.path.splitext(name)[1]
+        if ext not in MIME:
+            continue
+        with open(os.path.join(WWW, name), "rb") as f:
+            raw = f.read()
+        gz = gzip.compress(raw, compresslevel=9, mtime=0)
+        etag = hashlib.sha256(raw).hexdigest()[:16]
+        assets.append((name, ident(name), MIME[ext], gz, etag, len(raw)))
+
+    banner = "// Generated by tools/embed_web.py from www/ -- do not edit.\n"
+
+    with open(os.path.join(CLIENT, "web_assets.h"), "w") as h:
+        h.write(banner)
+        h.write("#pragma once\n#include \"web_static.h\"\n\n")
+        for name, sym, _, gz, _, raw_len in assets:
+            h.write("extern const WebAsset %s;  // %s, %d -> %d bytes\n" % (sym, name, raw_len, len(gz)))
+
+    with open(os.path.join(CLIENT, "web_assets.cpp"), "w") as c:
+        c.write(banner)
+        c.write("#include \"web_assets.h\"\n#include <pgmspace.h>\n")
+        for name, sym, mime, gz, etag, _ in assets:
+            c.write("\n// %s\nstatic const uint8_t %s_GZ[] PROGMEM = {\n" % (name, sym))
+            for i in range(0, len(gz), 16):
+                c.write("    " + ", ".join("0x%02x" % b for b in gz[i:i + 16]) + ",\n")
+            c.write("};\n")
+            c.write("const WebAsset %s = { \"%s\", %s_GZ, sizeof(%s_GZ), \"\\\"%s\\\"\" };\n"
+                    % (sym, mime, sym, sym, etag))
+
+    for name, _, _, gz, _, raw_len in assets:
+        print("%-16s %6d -> %6d bytes" % (name, raw_len, len(gz)))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,166 @@
+#include "web_arena.h"
+#include <esp_heap_caps.h>
+#include <new>
+
+// The arena object itself sits at the front of its first slab, so a
+// response needs nothing from the heap beyond what the server allocates.
+
+static uint8_t pool[WEB_ARENA_POOL][WEB_ARENA_SLAB] __attribute__((aligned(4)));
+static uint32_t poolFree = (1u << WEB_ARENA_POOL) - 1;
+static portMUX_TYPE mux = portMUX_INITIALIZER_UNLOCKED;
+
+static uint32_t inUse = 0, highWater = 0;
+static uint32_t responses = 0, heapSlabs = 0, overflows = 0, failures = 0;
+
+static uint8_t* takeSlab() {
+    uint8_t* p = nullptr;
+    portENTER_CRITICAL(&mux);
+    if (poolFree) {
+        int i = __builtin_ctz(poolFree);
+        poolFree &= ~(1u << i);
+        p = pool[i];
+    }
+    portEXIT_CRITICAL(&mux);
+    if (!p) {
+        p = (uint8_t*)heap_caps_malloc(WEB_ARENA_SLAB, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+        portENTER_CRITICAL(&mux);
+        if (p) heapSlabs++;
+        else failures++;
+        portEXIT_CRITICAL(&mux);
+        if (!p) return nullptr;
+    }
+    portENTER_CRITICAL(&mux);
+    if (++inUse > highWater) highWater = inUse;
+    portEXIT_CRITICAL(&mux);
+    return p;
+}
+
+static void giveSlab(uint8_t* p) {
+    bool fromPool = p >= pool[0] && p < pool[0] + sizeof(pool);
+    portENTER_CRITICAL(&mux);
+    if (fromPool) poolFree |= 1u << ((p - pool[0]) / WEB_ARENA_SLAB);
+    inUse--;
+    portEXIT_CRITICAL(&mux);
+    if (!fromPool) heap_caps_free(p);
+}
+
+WebArena* WebArena::create() {
+    uint8_t* first = takeSlab();
+    if (!first) return nullptr;
+    WebArena* a = new (first) WebArena();
+    a->slabs[0] = first;
+    a->start[0] = a->fill = (sizeof(WebArena) + 3) & ~3u;
+    a->nSlabs = 1;
+    return a;
+}
+
+size_t WebArena::write(const uint8_t* p, size_t n) {
+    size_t done = 0;
+    while (done < n && !overflow) {
+        size_t room = WEB_ARENA_SLAB - fill;
+        if (!room) {
+            uint8_t* s = nSlabs < WEB_ARENA_MAX_SLABS ? takeSlab() : nullptr;
+            if (!s) {
+                overflow = true;
+                portENTER_CRITICAL(&mux);
+                overflows++;
+                portEXIT_CRITICAL(&mux);
+                break;
+            }
+            slabs[nSlabs] = s;
+            start[nSlabs] = 0;
+            nSlabs++;
+            fill = 0;
+            continue;
+        }
+        size_t k = n - done < room ? n - done : room;
+        memcpy(slabs[nSlabs - 1] + fill, p + done, k);
+        fill += k;
+        done += k;
+        len += k;
+    }
+    return done;
+}
+
+void WebArena::html(const char* s) {
+    const char* run = s;
+    for (; *s; ++s) {
+        const char* rep;
+        switch (*s) {
+            case '&':  rep = "&amp;";  break;
+            case '<':  rep = "&lt;";   break;
+            case '>':  rep = "&gt;";   break;
+            case '"':  rep = "&quot;"; break;
+            case '\'': rep = "&#39;";  break;
+            default:   continue;
+        }
+        write((const uint8_t*)run, s - run);
+        print(rep);
+        run = s + 1;
+    }
+    write((const uint8_t*)run, s - run);
+}
+
+size_t WebArena::read(uint8_t* buf, size_t maxLen, size_t index) const {
+    size_t out = 0;
+    uint8_t i = 0;
+    size_t skip = index;
+    while (i < nSlabs && skip >= (size_t)(WEB_ARENA_SLAB - start[i])) {
+        skip -= WEB_ARENA_SLAB - start[i];
+        ++i;
+    }
+    while (out < maxLen && index + out < len && i < nSlabs) {
+        size_t avail = WEB_ARENA_SLAB - start[i] - skip;
+        if (avail > len - index - out) avail = len - index - out;
+        size_t k = avail < maxLen - out ? avail : maxLen - out;
+        memcpy(buf + out, slabs[i] + start[i] + skip, k);
+        out += k;
+        skip = 0;
+        ++i;
+    }
+    return out;
+}
+
+void WebArena::release() {
+    // Slab 0 holds this object; give it back last
+    for (uint8_t i = nSlabs; i-- > 1;) giveSlab(slabs[i]);
+    uint8_t* first = slabs[0];
+    this->~WebArena();
+    giveSlab(first);
+}
+
+// Copyable handle for the filler lambda; the last copy to go (when the
+// server destroys the response) releases the arena. Responses are built
+// and torn down on the async_tcp task, so the count needs no lock.
+struct WebArenaRef {
+    WebArena* a;
+    explicit WebArenaRef(WebArena* p) : a(p) { a->refs++; }
+    WebArenaRef(const WebArenaRef& o) : a(o.a) { a->refs++; }
+    WebArenaRef& operator=(const WebArenaRef&) = delete;
+    ~WebArenaRef() { if (--a->refs == 0) a->release(); }
+};
+
+void WebArena::send(AsyncWebServerRequest* request, int code, const char* contentType) {
+    portENTER_CRITICAL(&mux);
+    responses++;
+    portEXIT_CRITICAL(&mux);
+    WebArenaRef ref(this);
+    AsyncWebServerResponse* response = request->beginResponse(contentType, len,
+        [ref](uint8_t* buf, size_t maxLen, size_t index) -> size_t {
+            return ref.a->read(buf, maxLen, index);
+        });
+    response->setCode(code);
+    request->send(response);
+}
+
+void WebArena::writeMetrics(Print& out) {
+    portENTER_CRITICAL(&mux);
+    uint32_t u = inUse, hw = highWater, r = responses, h = heapSlabs, o = overflows, f = failures;
+    portEXIT_CRITICAL(&mux);
+    out.printf("# TYPE lovebyte_web_arena_slabs_in_use gauge\nlovebyte_web_arena_slabs_in_use %u\n", (unsigned)u);
+    out.printf("# TYPE lovebyte_web_arena_slabs_high_water gauge\nlovebyte_web_arena_slabs_high_water %u\n", (unsigned)hw);
+    out.printf("# TYPE lovebyte_web_arena_responses_total counter\nlovebyte_web_arena_responses_total %u\n", (unsigned)r);
+    out.printf("# TYPE lovebyte_web_arena_heap_slabs_total counter\nlovebyte_web_arena_heap_slabs_total %u\n", (unsigned)h);
+    out.printf("# TYPE lovebyte_web_arena_overflows_total counter\nlovebyte_web_arena_overflows_total %u\n", (unsigned)o);
+    out.printf("# TYPE lovebyte_web_arena_failures_total counter\nlovebyte_web_arena_failures_total %u\n", (unsigned)f);
+}
@@ -0,0 +1,51 @@
+// web_arena.h
+#pragma once
+#include <ESPAsyncWebServer.h>
+
+// Per-request bump arena for building small dynamic responses. Handlers
+// print into it (print/printf/html) instead of growing a String; the bytes
+// land back to back in fixed slabs taken from a static pool, and every
+// slab goes back in one go when the server drops the response. Building a
+// page therefore costs no heap allocations and leaves no holes in internal
+// RAM. If the pool runs dry, slabs come from the heap and are counted.
+
+#define WEB_ARENA_SLAB       1024
+#define WEB_ARENA_POOL       8      // static slabs shared by all in-flight responses
+#define WEB_ARENA_MAX_SLABS  8      // per response; output past this is dropped
+
+class WebArena : public Print {
+public:
+    // nullptr if neither the pool nor the heap has a slab left
+    static WebArena* create();
+
+    size_t write(uint8_t c) override { return write(&c, 1); }
+    size_t write(const uint8_t* p, size_t n) override;
+    using Print::write;
+
+    // Append s with HTML metacharacters escaped
+    void html(const char* s);
+
+    size_t length() const { return len; }
+
+    // Send what was written and hand the arena over to the response. Every
+    // created arena must be sent, and not touched afterwards.
+    void send(AsyncWebServerRequest* request, int code, const char* contentType);
+
+    // Slab pool gauges and counters for /metrics
+    static void writeMetrics(Print& out);
+
+private:
+    WebArena() {}
+    void release();
+    size_t read(uint8_t* buf, size_t maxLen, size_t index) const;
+
+    uint8_t* slabs[WEB_ARENA_MAX_SLABS];
+    uint16_t start[WEB_ARENA_MAX_SLABS];    // first content byte in each slab
+    uint16_t fill = 0;                      // write offset in the last slab
+    uint8_t nSlabs = 0;
+    bool overflow = false;
+    uint16_t refs = 0;
+    size_t len = 0;
+
+    friend struct WebArenaRef;
+};
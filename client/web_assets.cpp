@@ -0,0 +1,784 @@
+// Generated by tools/embed_web.py from www/ -- do not edit.
+#include "web_assets.h"
+#include <pgmspace.h>
+
+// cloud.html
+static const uint8_t ASSET_CLOUD_HTML_GZ[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xbd, 0x58, 0xeb, 0x6f, 0xdb, 0xc8,
+    0x11, 0xff, 0xee, 0xbf, 0x62, 0xcc, 0x6b, 0x43, 0x0a, 0x51, 0x48, 0xd9, 0x49, 0x83, 0x8b, 0x2c,
+    0x29, 0xb8, 0xd8, 0x4a, 0xab, 0x83, 0xaf, 0x36, 0x62, 0xe7, 0x80, 0xa2, 0x57, 0x18, 0x14, 0x39,
+    0x12, 0x69, 0x93, 0x5c, 0xde, 0xee, 0xd2, 0xb2, 0x10, 0xeb, 0x7f, 0xbf, 0xd9, 0x07, 0x29, 0xca,
+    0xf2, 0xf3, 0x9a, 0xd6, 0x5f, 0xbc, 0xe4, 0xce, 0xfb, 0xf1, 0x9b, 0xa1, 0x06, 0xbb, 0x47, 0x27,
+    0x87, 0xe7, 0xff, 0x3a, 0x1d, 0x43, 0x22, 0xf3, 0x6c, 0xb4, 0x33, 0xa8, 0xff, 0x61, 0x18, 0x8f,
+    0x76, 0x00, 0x06, 0x32, 0x95, 0x19, 0x8e, 0x8e, 0xd9, 0x35, 0x7e, 0x5a, 0x4a, 0x84, 0xc3, 0x8c,
+    0x55, 0x31, 0xfc, 0x82, 0x42, 0x60, 0x31, 0x47, 0x3e, 0x08, 0xcc, 0xbd, 0xa2, 0xcc, 0x51, 0x86,
+    0x50, 0x84, 0x39, 0x0e, 0x9d, 0xeb, 0x14, 0x17, 0x25, 0xe3, 0xd2, 0x81, 0x88, 0x15, 0x12, 0x0b,
+    0x39, 0x74, 0x16, 0x69, 0x2c, 0x93, 0xe1, 0xdb, 0xf7, 0xbd, 0x2e, 0xa4, 0x45, 0x2a, 0xd3, 0x30,
+    0x7b, 0x23, 0xa2, 0x30, 0xc3, 0xe1, 0x9e, 0xa3, 0xb9, 0xb3, 0xb4, 0xb8, 0x02, 0x8e, 0xd9, 0xd0,
+    0x11, 0x72, 0x99, 0xa1, 0x48, 0x10, 0x89, 0x3d, 0xe1, 0x38, 0x1b, 0x3a, 0x41, 0x36, 0x0d, 0xf4,
+    0x5b, 0x3f, 0x12, 0x82, 0xc8, 0x07, 0x81, 0x31, 0x6f, 0x30, 0x65, 0xf1, 0x52, 0x73, 0x27, 0xfb,
+    0x8f, 0x98, 0x48, 0x97, 0x8a, 0x26, 0x4e, 0xaf, 0x21, 0xca, 0x42, 0x21, 0x48, 0x05, 0x46, 0x32,
+    0x65, 0x85, 0x33, 0x1a, 0xcc, 0x18, 0xcf, 0x21, 0x8d, 0x87, 0x4e, 0x2e, 0xe6, 0xea, 0xac, 0x8d,
+    0x51, 0xe6, 0x84, 0x53, 0xcc, 0x46, 0xe7, 0x21, 0x9f, 0xa3, 0x84, 0x23, 0xbc, 0x4e, 0x23, 0x84,
+    0xc9, 0x51, 0x7f, 0x10, 0x98, 0x8b, 0xc1, 0x94, 0x5b, 0xc2, 0xb4, 0x28, 0x2b, 0x09, 0x72, 0x59,
+    0x92, 0xdb, 0x12, 0x6f, 0xc8, 0x66, 0x25, 0x8d, 0x63, 0x94, 0x96, 0x29, 0x39, 0xee, 0x80, 0x36,
+    0xdc, 0xfa, 0xdf, 0xff, 0xb0, 0xff, 0xd7, 0x83, 0x9c, 0x84, 0xa6, 0xc5, 0x9b, 0x29, 0x93, 0x92,
+    0xe5, 0xfd, 0x1f, 0xcb, 0x1b, 0xa7, 0x25, 0xce, 0x88, 0x57, 0xc6, 0x87, 0x73, 0xbc, 0x47, 0x9d,
+    0x52, 0x11, 0x72, 0x0c, 0x6b, 0x9b, 0x1d, 0x28, 0xb3, 0x30, 0xc2, 0x84, 0x65, 0x31, 0xf2, 0xa1,
+    0x73, 0x4e, 0x76, 0xc0, 0x92, 0x55, 0x1c, 0x72, 0x23, 0x02, 0x12, 0xe4, 0x48, 0x0a, 0x82, 0x9a,
+    0x71, 0x4b, 0xd7, 0x86, 0x07, 0x51, 0x82, 0xd1, 0xd5, 0x94, 0xdd, 0x18, 0x2f, 0x2a, 0x81, 0x17,
+    0x19, 0xc6, 0xce, 0x08, 0xbe, 0x0a, 0x84, 0xe3, 0xf1, 0x11, 0x1c, 0xb2, 0x8c, 0x71, 0xa8, 0xcd,
+    0xda, 0x8e, 0x40, 0xa4, 0xee, 0x0d, 0xb3, 0x3d, 0x5e, 0x87, 0x59, 0x45, 0x17, 0x3f, 0xcc, 0xf4,
+    0x9f, 0x03, 0x71, 0x2a, 0xc2, 0x29, 0x09, 0x7d, 0xa9, 0x1d, 0xc9, 0xd4, 0x9a, 0xf1, 0x0f, 0x0c,
+    0xb9, 0x9c, 0x62, 0x28, 0x9f, 0x67, 0x46, 0x52, 0x93, 0x5f, 0x6c, 0x19, 0xf4, 0xfe, 0xc3, 0xf4,
+    0x5d, 0xcb, 0xa0, 0x96, 0x31, 0x75, 0xd2, 0x6c, 0xaa, 0x32, 0x9c, 0xc9, 0xfe, 0xde, 0xbe, 0xca,
+    0xd4, 0x69, 0x95, 0x09, 0x14, 0xfd, 0x87, 0x55, 0x17, 0x55, 0x3e, 0xc5, 0x2d, 0xdd, 0xa5, 0x66,
+    0x73, 0x20, 0x4f, 0x8b, 0xa1, 0xb3, 0x47, 0xff, 0xc3, 0x1b, 0xfa, 0xdf, 0x6b, 0xac, 0x79, 0xbb,
+    0xb6, 0x63, 0xb3, 0x60, 0xde, 0xbd, 0xdf, 0xac, 0x8f, 0x69, 0x45, 0x55, 0x53, 0xd4, 0x75, 0x3c,
+    0x95, 0x85, 0x63, 0xf5, 0x8a, 0x6a, 0x9a, 0xa7, 0xd2, 0x19, 0x9d, 0x61, 0x61, 0x8a, 0x9f, 0x92,
+    0x3f, 0x08, 0x0c, 0xb9, 0xe5, 0x6d, 0x35, 0x00, 0x47, 0x51, 0x65, 0xb6, 0x56, 0xa9, 0x8a, 0x2e,
+    0xec, 0x33, 0xd5, 0x09, 0x11, 0xe9, 0x6e, 0x09, 0x54, 0x37, 0xb4, 0x9e, 0x1f, 0xef, 0x9e, 0x34,
+    0x37, 0xdd, 0x03, 0x58, 0x44, 0xc6, 0x9e, 0x9c, 0xe4, 0xa5, 0x25, 0xf9, 0xaf, 0x05, 0xbd, 0x89,
+    0x43, 0x19, 0x7e, 0xef, 0xde, 0xba, 0x20, 0xad, 0x7f, 0xae, 0xbf, 0x74, 0x90, 0x26, 0x39, 0x85,
+    0x28, 0xf8, 0xfb, 0xe4, 0xf3, 0x13, 0x9a, 0x67, 0x69, 0x86, 0x8e, 0x05, 0x36, 0x73, 0x56, 0x56,
+    0x98, 0x53, 0x18, 0x45, 0x58, 0x4a, 0xe5, 0xbf, 0x92, 0x75, 0x59, 0xe2, 0xbc, 0x6b, 0x8e, 0x65,
+    0x51, 0x9f, 0xe6, 0x29, 0x55, 0x3d, 0xc7, 0xdf, 0xab, 0x94, 0xdb, 0xaa, 0x7f, 0x69, 0x36, 0x1b,
+    0x43, 0x9f, 0x97, 0x4f, 0x8a, 0xca, 0x33, 0xf2, 0x59, 0xd6, 0xac, 0x33, 0xc6, 0x88, 0xf0, 0x55,
+    0xc4, 0xca, 0xe5, 0x01, 0x1c, 0x85, 0xfc, 0x8a, 0x15, 0xf8, 0xe3, 0xdb, 0x41, 0x50, 0x12, 0xbe,
+    0x8a, 0x88, 0xa7, 0xa5, 0x1c, 0xed, 0xc4, 0x2c, 0xaa, 0x72, 0x8a, 0xb8, 0x1f, 0xc6, 0xf1, 0xf8,
+    0x9a, 0x0e, 0xc7, 0xa9, 0x20, 0x58, 0x47, 0xee, 0xb9, 0x47, 0x27, 0xbf, 0x1c, 0x1a, 0x8c, 0x3f,
+    0x66, 0x61, 0x8c, 0xb1, 0xdb, 0x85, 0x59, 0x55, 0xe8, 0x02, 0xf1, 0x3a, 0xf0, 0x8d, 0x54, 0x5d,
+    0x87, 0x1c, 0x8e, 0xc6, 0xbf, 0x4e, 0x0e, 0xc7, 0x17, 0x93, 0x23, 0x18, 0x82, 0xeb, 0x1e, 0xd8,
+    0xb7, 0x67, 0xe3, 0x2f, 0xbf, 0x8e, 0xbf, 0x5c, 0x7c, 0xfa, 0xe9, 0x6c, 0xdc, 0xbc, 0x9f, 0xa1,
+    0x8c, 0x12, 0xcf, 0x0d, 0xc2, 0x32, 0x0d, 0x22, 0x85, 0xe4, 0x6e, 0xc7, 0x97, 0x09, 0x16, 0x1e,
+    0x87, 0xe1, 0x08, 0xb8, 0x7f, 0x29, 0x94, 0x60, 0xfb, 0x2e, 0x52, 0xef, 0xbe, 0xe9, 0x68, 0xb4,
+    0x35, 0x44, 0x7e, 0xac, 0xab, 0xea, 0x40, 0xdf, 0x6c, 0x6a, 0x89, 0xfc, 0x69, 0x28, 0xec, 0x4d,
+    0xe3, 0x16, 0x15, 0xe2, 0x38, 0x43, 0x75, 0xfc, 0xb4, 0x9c, 0xc4, 0x9e, 0xdb, 0x94, 0x18, 0x29,
+    0xd7, 0x1d, 0x4a, 0x8c, 0x8d, 0x82, 0xe7, 0xf2, 0xaa, 0xf2, 0x7c, 0x88, 0x7f, 0xd5, 0x39, 0xd8,
+    0xa1, 0x7f, 0x34, 0x1d, 0x85, 0x04, 0x6a, 0xfa, 0x43, 0x85, 0x77, 0x44, 0xf4, 0xa0, 0x54, 0x0b,
+    0xc5, 0x6e, 0xe7, 0xa0, 0x61, 0xd3, 0x78, 0x36, 0xd1, 0x85, 0xfa, 0x08, 0xa3, 0xa6, 0x6a, 0xb3,
+    0x25, 0xd3, 0x67, 0x29, 0x4b, 0xa6, 0x77, 0x98, 0x9e, 0xa5, 0xed, 0x0e, 0xda, 0x6e, 0x8a, 0x30,
+    0xd8, 0xf9, 0x02, 0x19, 0x06, 0x35, 0x8d, 0x90, 0x3a, 0x48, 0x3e, 0x2b, 0xa2, 0x24, 0xa4, 0xc1,
+    0x4e, 0x22, 0xda, 0x85, 0xd6, 0x0a, 0x87, 0xdf, 0x40, 0xe9, 0x10, 0x76, 0x65, 0x92, 0x0a, 0x5f,
+    0x8f, 0x13, 0x8c, 0x0f, 0x60, 0xa5, 0x44, 0xd9, 0x08, 0x3c, 0x24, 0x49, 0xa7, 0xb7, 0xed, 0xf0,
+    0xc3, 0xf2, 0x2c, 0x69, 0xcb, 0xb1, 0x47, 0x69, 0x57, 0x26, 0x1a, 0xf7, 0xca, 0x6d, 0xfc, 0x6b,
+    0xd1, 0x3f, 0x68, 0x44, 0xed, 0xc1, 0x06, 0xed, 0x43, 0x56, 0x6c, 0x11, 0x13, 0x75, 0x10, 0xd4,
+    0x33, 0x02, 0x14, 0x2e, 0xf4, 0xe1, 0xa7, 0xd3, 0x89, 0x06, 0x29, 0xa4, 0x4c, 0xcd, 0x19, 0x0a,
+    0x90, 0x0c, 0x94, 0xf9, 0x30, 0x3e, 0x3b, 0x7d, 0xbb, 0xdf, 0x85, 0x45, 0x92, 0x46, 0x09, 0x94,
+    0x9c, 0xdd, 0xa4, 0xf5, 0x25, 0x82, 0x40, 0x7e, 0x8d, 0x7c, 0xe7, 0x91, 0x66, 0xb0, 0x5b, 0x15,
+    0xb5, 0x01, 0xd5, 0x80, 0xc6, 0xb4, 0x76, 0xb0, 0xb1, 0x63, 0x82, 0x8d, 0x7e, 0xc9, 0x51, 0xc1,
+    0xca, 0x11, 0xce, 0x42, 0xc2, 0x2d, 0xaf, 0x63, 0x22, 0xab, 0x30, 0xa2, 0x69, 0xa7, 0xc7, 0x4a,
+    0x66, 0xab, 0x5f, 0x7d, 0xc9, 0xd3, 0xbc, 0x16, 0x93, 0xce, 0xbc, 0x86, 0xa0, 0xb3, 0x21, 0xb0,
+    0x39, 0xfb, 0x1c, 0xf5, 0x1e, 0xe5, 0x05, 0xbf, 0x89, 0xd7, 0xc1, 0xbc, 0x4b, 0x60, 0xb4, 0x66,
+    0xde, 0x6d, 0x71, 0x7f, 0x03, 0xda, 0x59, 0xb9, 0xf4, 0xdc, 0xd3, 0x0c, 0x09, 0x47, 0x68, 0xde,
+    0x49, 0xe4, 0x10, 0xaa, 0x39, 0x9e, 0xc6, 0x70, 0x77, 0xa6, 0x91, 0x10, 0xd2, 0x21, 0x2b, 0x5e,
+    0x50, 0xe9, 0x35, 0x2e, 0x51, 0x50, 0x1e, 0x73, 0x86, 0xae, 0x1f, 0x72, 0x63, 0x97, 0xee, 0x5a,
+    0x36, 0xd4, 0x29, 0x8c, 0xc2, 0xa2, 0x60, 0x12, 0xa6, 0x64, 0x4e, 0x5e, 0xca, 0xe5, 0xfd, 0x5a,
+    0xcb, 0x70, 0x99, 0x11, 0x42, 0x93, 0x66, 0x13, 0x74, 0x58, 0x7b, 0xdf, 0x5f, 0x1f, 0xbb, 0xf6,
+    0x4e, 0x8d, 0xdb, 0xbe, 0xb2, 0xb4, 0x7e, 0x41, 0xcb, 0x34, 0x6d, 0x98, 0xfd, 0x35, 0x8c, 0x35,
+    0x94, 0x69, 0x8e, 0x7d, 0x28, 0x70, 0x41, 0xc3, 0x43, 0xa2, 0x47, 0xc8, 0xcc, 0x26, 0x67, 0x27,
+    0x67, 0x64, 0x79, 0x31, 0xa7, 0x27, 0x91, 0x51, 0x28, 0xbc, 0x5e, 0x77, 0xef, 0x43, 0xa7, 0x09,
+    0xb2, 0x7b, 0xee, 0x76, 0x5d, 0x70, 0x3b, 0xb5, 0x88, 0x05, 0x35, 0x7b, 0xa2, 0x84, 0xbb, 0x34,
+    0x3d, 0xa2, 0x54, 0x2e, 0xed, 0x89, 0x55, 0x85, 0xe4, 0xf6, 0x41, 0x92, 0x6b, 0x9f, 0xfb, 0xd0,
+    0xab, 0x79, 0x54, 0xbf, 0xa8, 0xe6, 0xe8, 0xb7, 0x1b, 0xca, 0x04, 0xad, 0x51, 0xf3, 0x03, 0xa9,
+    0x51, 0xe3, 0x83, 0x7d, 0x2d, 0x4b, 0xe4, 0x87, 0x94, 0x2f, 0xaf, 0xd1, 0x49, 0x18, 0x77, 0xdc,
+    0x88, 0xb8, 0xdb, 0x7c, 0x2d, 0xa2, 0x66, 0xdd, 0xec, 0xc3, 0x9d, 0x46, 0xaa, 0x89, 0x1a, 0xbc,
+    0xb2, 0xc2, 0x36, 0xba, 0xf6, 0x05, 0x16, 0x35, 0x72, 0xec, 0x8e, 0x49, 0x19, 0xe3, 0x02, 0x27,
+    0x85, 0xf4, 0x36, 0x7b, 0x5b, 0x8b, 0xec, 0xc2, 0x5e, 0xaf, 0x03, 0xb7, 0xb7, 0xd0, 0xd3, 0xdc,
+    0x2b, 0x53, 0x22, 0x0a, 0x69, 0x19, 0x7d, 0x26, 0x65, 0x6c, 0x4e, 0x15, 0x6a, 0x13, 0x4e, 0xcd,
+    0xaa, 0x92, 0xd7, 0xa7, 0x20, 0xda, 0x1a, 0xd8, 0x68, 0x2f, 0xb5, 0x28, 0x3c, 0x51, 0x8e, 0x76,
+    0x9d, 0xa8, 0x5b, 0xc2, 0x3c, 0xf9, 0x69, 0x41, 0x0b, 0xc0, 0x39, 0xd5, 0x09, 0x71, 0x3b, 0x6a,
+    0x51, 0xa1, 0x84, 0xfb, 0xbe, 0xef, 0x18, 0x22, 0x42, 0x98, 0x73, 0x82, 0x08, 0x33, 0x88, 0x21,
+    0x2c, 0xc4, 0x02, 0xb9, 0x00, 0xda, 0xda, 0x09, 0x75, 0x11, 0x16, 0xa9, 0x4c, 0xa8, 0x6b, 0x2e,
+    0xd9, 0x94, 0x56, 0x16, 0xba, 0x8d, 0x15, 0x0c, 0x2d, 0x42, 0x1e, 0x0b, 0xfa, 0x3a, 0xd4, 0xd8,
+    0x32, 0x0d, 0xa3, 0xab, 0x39, 0xa7, 0x0a, 0x88, 0xb5, 0xb8, 0x1a, 0x33, 0xa0, 0x64, 0x59, 0xe6,
+    0x11, 0x1f, 0x55, 0x04, 0x27, 0x28, 0xea, 0x34, 0xd5, 0xdc, 0x5e, 0x1c, 0xca, 0x4a, 0x24, 0x81,
+    0x31, 0xf3, 0x23, 0xd1, 0x0e, 0x5d, 0x78, 0xad, 0x74, 0x3d, 0xb2, 0x49, 0x88, 0xf5, 0x26, 0x61,
+    0x7a, 0x0d, 0x3c, 0xe1, 0x0b, 0x49, 0x15, 0x0d, 0xc3, 0x21, 0xed, 0x26, 0xa5, 0xf1, 0xcf, 0xed,
+    0xb4, 0x88, 0x0c, 0x99, 0x36, 0x03, 0x46, 0xf0, 0xae, 0xa7, 0x3a, 0xf3, 0x9e, 0xd8, 0xb8, 0x63,
+    0xce, 0x55, 0x5d, 0x14, 0x0c, 0x54, 0x1d, 0x2c, 0x61, 0xc6, 0x59, 0x6e, 0xb1, 0xd3, 0xbd, 0xdb,
+    0xa9, 0x75, 0xb3, 0xc9, 0x73, 0x6a, 0x2b, 0x56, 0x49, 0x8f, 0x26, 0x12, 0x59, 0x76, 0xc7, 0x6b,
+    0x72, 0x67, 0xaf, 0xd3, 0x85, 0xfd, 0xbf, 0xf5, 0x6c, 0x4a, 0xea, 0x86, 0xd6, 0xa2, 0x9a, 0x37,
+    0x6b, 0x91, 0x2a, 0xd5, 0x97, 0xaa, 0xf5, 0x57, 0xeb, 0x5b, 0x6a, 0x2d, 0x32, 0x58, 0xbd, 0xfd,
+    0xf9, 0xec, 0xe4, 0x9f, 0xbe, 0xae, 0x36, 0x72, 0x5a, 0xdb, 0x48, 0x08, 0xb2, 0x22, 0x58, 0xa1,
+    0x88, 0x02, 0xa1, 0xb4, 0x22, 0xf3, 0x51, 0x79, 0x41, 0xc4, 0x96, 0x42, 0xd5, 0x9e, 0x8d, 0x50,
+    0xdb, 0xf6, 0x8d, 0x0a, 0xfc, 0x82, 0xa2, 0xa4, 0x67, 0x54, 0xa5, 0x47, 0x83, 0x90, 0xc5, 0x54,
+    0xb6, 0x97, 0x2d, 0x8b, 0xef, 0x09, 0x96, 0x77, 0xa9, 0x65, 0x56, 0xc2, 0x84, 0x9d, 0x06, 0x52,
+    0xa5, 0xb6, 0x1e, 0xf8, 0x08, 0x0d, 0xda, 0x51, 0x31, 0xcb, 0x5d, 0x17, 0xfa, 0xe0, 0xb9, 0x9f,
+    0x43, 0xda, 0xc2, 0x63, 0x02, 0x88, 0xd7, 0x9e, 0x35, 0xf0, 0xf6, 0xd6, 0xfd, 0x5a, 0x5c, 0x15,
+    0x6c, 0x51, 0xb8, 0x9d, 0x46, 0xd3, 0xaa, 0xe3, 0x6b, 0x5f, 0x3c, 0xd4, 0x59, 0x7e, 0x2c, 0x49,
+    0xaa, 0x52, 0x94, 0x43, 0x96, 0xd7, 0x38, 0x76, 0xb7, 0xb4, 0xc8, 0x9d, 0xba, 0x0a, 0x72, 0x94,
+    0x09, 0xa3, 0xde, 0x3a, 0x3d, 0x39, 0x23, 0x50, 0x5b, 0x77, 0x32, 0x61, 0xa5, 0xe8, 0x7f, 0x73,
+    0xed, 0x6a, 0xfc, 0x46, 0x7d, 0x97, 0xbb, 0x7d, 0x37, 0x2c, 0x4b, 0x82, 0xc3, 0x50, 0x15, 0x72,
+    0xa0, 0xca, 0xcf, 0x5d, 0xd5, 0x2c, 0xea, 0x97, 0x8c, 0xbe, 0xce, 0x83, 0xd0, 0xc8, 0x99, 0xce,
+    0x96, 0x5e, 0xdd, 0xad, 0xc6, 0x12, 0xf3, 0x6f, 0xa3, 0x82, 0xd9, 0x15, 0xc5, 0xa5, 0x2e, 0x64,
+    0x0a, 0x08, 0xf7, 0x15, 0x6c, 0x7b, 0xb6, 0xa4, 0xa5, 0x72, 0x4c, 0xb9, 0x2b, 0x13, 0xce, 0x16,
+    0x40, 0x8f, 0xca, 0xaf, 0xb6, 0x98, 0xcb, 0x75, 0x69, 0xf9, 0xba, 0xb8, 0x7a, 0xf5, 0xf5, 0x9f,
+    0x0a, 0xd7, 0xaa, 0x5e, 0x2d, 0xf4, 0x07, 0x8b, 0x5d, 0x2c, 0xea, 0x3d, 0xc2, 0x02, 0x41, 0x4c,
+    0x5f, 0x41, 0x91, 0xcc, 0x96, 0x5d, 0x60, 0x0a, 0xf2, 0x17, 0x29, 0xcd, 0x50, 0xbb, 0x4d, 0x94,
+    0x4b, 0x0a, 0x65, 0xf1, 0x8c, 0xa5, 0xc2, 0x7e, 0x6c, 0xfe, 0xdf, 0x96, 0x8a, 0xf6, 0x22, 0xff,
+    0x3d, 0x17, 0x0b, 0xf8, 0xee, 0x9b, 0x85, 0xfa, 0x28, 0x7d, 0x72, 0xbf, 0x56, 0x44, 0xee, 0x8b,
+    0x46, 0xc0, 0xfa, 0x8b, 0x72, 0xc3, 0xf8, 0x46, 0x9b, 0xaf, 0x4e, 0xc2, 0xcf, 0xb0, 0x98, 0xcb,
+    0xa4, 0xd3, 0xda, 0x2f, 0xb6, 0xe7, 0xc4, 0x97, 0x26, 0x48, 0x1a, 0xf4, 0x89, 0xaf, 0xf9, 0x36,
+    0xae, 0x27, 0xc7, 0x26, 0x8e, 0xb5, 0x9c, 0x53, 0xbb, 0x8b, 0xda, 0x33, 0x3e, 0x53, 0xf2, 0x69,
+    0xd7, 0x08, 0xeb, 0x34, 0xcc, 0x62, 0x9f, 0x1a, 0x8b, 0x00, 0xda, 0xfa, 0xd6, 0x85, 0x3b, 0x96,
+    0xfd, 0xbb, 0xf7, 0x9f, 0x6d, 0xd2, 0xf5, 0xce, 0xd8, 0x5d, 0xa7, 0xeb, 0x25, 0x13, 0x4e, 0xd9,
+    0x94, 0xb1, 0x28, 0xcc, 0xda, 0xf9, 0xd6, 0xb0, 0xb5, 0xfe, 0x16, 0x7d, 0xf5, 0x0a, 0x82, 0xdf,
+    0x7c, 0xef, 0xb2, 0xc4, 0x8f, 0xf3, 0x5b, 0x6a, 0xea, 0xce, 0x5f, 0x82, 0x94, 0x9a, 0x54, 0x48,
+    0x6f, 0xdb, 0x44, 0x5f, 0xfd, 0xc4, 0x50, 0xdb, 0xa9, 0x11, 0xc7, 0x48, 0x27, 0xe8, 0xd3, 0xc8,
+    0x53, 0x95, 0x0a, 0x0d, 0x3e, 0x8a, 0x84, 0x2d, 0x86, 0x7b, 0x0a, 0xff, 0xda, 0x1f, 0xb6, 0xaf,
+    0x37, 0x88, 0x2e, 0xf4, 0x4f, 0x0f, 0xdb, 0x30, 0x05, 0x16, 0xa7, 0x0c, 0xdc, 0x50, 0x34, 0xfe,
+    0xb7, 0xd0, 0x52, 0x6b, 0xdf, 0x18, 0x0a, 0x06, 0x1c, 0x8c, 0x9d, 0x2a, 0xd0, 0xcd, 0x84, 0x58,
+    0x4f, 0x86, 0xa7, 0xe7, 0x82, 0x61, 0xaf, 0x27, 0x83, 0x11, 0xf9, 0xc4, 0x5c, 0xb8, 0xf4, 0x8d,
+    0xd8, 0x7a, 0x2c, 0xac, 0xfe, 0x4b, 0xa8, 0x53, 0x87, 0x41, 0x50, 0xff, 0x42, 0x32, 0x08, 0xcc,
+    0x6f, 0xd1, 0x83, 0xc0, 0xfc, 0x80, 0xfe, 0x07, 0xfa, 0xa7, 0x51, 0x87, 0x58, 0x17, 0x00, 0x00,
+};
+const WebAsset ASSET_CLOUD_HTML = { "text/html", ASSET_CLOUD_HTML_GZ, sizeof(ASSET_CLOUD_HTML_GZ), "\"4f99e0be7ade2575\"" };
+
+// config.html
+static const uint8_t ASSET_CONFIG_HTML_GZ[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x8d, 0x56, 0x51, 0x6f, 0xe3, 0x36,
+    0x0c, 0x7e, 0xbf, 0x5f, 0xc1, 0x19, 0xc3, 0xe2, 0x00, 0x6d, 0xdc, 0xe6, 0x0e, 0xb7, 0xc1, 0xb1,
+    0x03, 0xec, 0xda, 0x7b, 0xe8, 0x76, 0x6b, 0x03, 0x34, 0xc0, 0xb0, 0xbd, 0x29, 0x36, 0x9d, 0x68,
+    0x75, 0x24, 0x43, 0xa2, 0xd3, 0x4b, 0x8b, 0xfe, 0xf7, 0x51, 0x92, 0x93, 0xd4, 0x6d, 0x73, 0xe8,
+    0x93, 0x29, 0xea, 0xa3, 0x48, 0x7d, 0xe6, 0x27, 0x29, 0xfb, 0xe9, 0xf2, 0xe6, 0x62, 0xfe, 0xcf,
+    0xec, 0x2b, 0xac, 0x68, 0x5d, 0x4f, 0x3f, 0x64, 0xbb, 0x0f, 0x8a, 0x72, 0xfa, 0x01, 0x20, 0x23,
+    0x49, 0x35, 0x4e, 0xbf, 0xe9, 0x0d, 0x7e, 0xd9, 0x12, 0xc2, 0x85, 0x56, 0x95, 0x5c, 0x66, 0x49,
+    0x70, 0x3b, 0xc0, 0x1a, 0x49, 0x80, 0x12, 0x6b, 0xcc, 0xa3, 0x8d, 0xc4, 0xfb, 0x46, 0x1b, 0x8a,
+    0xa0, 0xd0, 0x8a, 0x50, 0x51, 0x1e, 0xdd, 0xcb, 0x92, 0x56, 0xf9, 0xc7, 0xcf, 0x67, 0x27, 0x20,
+    0x95, 0x24, 0x29, 0xea, 0x53, 0x5b, 0x88, 0x1a, 0xf3, 0xf3, 0xc8, 0x47, 0xd7, 0x52, 0xdd, 0x81,
+    0xc1, 0x3a, 0x8f, 0x2c, 0x6d, 0x6b, 0xb4, 0x2b, 0x44, 0x0e, 0x5f, 0x19, 0xac, 0xf2, 0x28, 0xa9,
+    0x17, 0x89, 0xf7, 0x8e, 0x0a, 0x6b, 0x19, 0x9e, 0x25, 0xa1, 0xaa, 0x6c, 0xa1, 0xcb, 0xad, 0x8f,
+    0x5e, 0x8d, 0xa7, 0x97, 0xb8, 0x91, 0xc5, 0xae, 0xae, 0xd6, 0x08, 0x92, 0x5a, 0x31, 0x70, 0xec,
+    0xe7, 0x2b, 0x6d, 0xd6, 0x20, 0xcb, 0x3c, 0x2a, 0xaa, 0xa5, 0xb3, 0xb9, 0xb0, 0x5a, 0x58, 0xcb,
+    0xc9, 0xb0, 0x70, 0xc0, 0x08, 0xb4, 0xb2, 0xed, 0x62, 0x2d, 0xb9, 0x52, 0x2b, 0x36, 0x78, 0x51,
+    0x2d, 0xe3, 0xe1, 0xc4, 0x20, 0xb5, 0x46, 0x41, 0x25, 0x6a, 0x8b, 0x13, 0x5f, 0xa6, 0x2b, 0x54,
+    0x2c, 0xb0, 0xde, 0x85, 0x1b, 0x7d, 0x1f, 0xed, 0x32, 0x5f, 0xf3, 0xd6, 0xd3, 0x2c, 0xf1, 0xf3,
+    0x1d, 0x56, 0xaa, 0xa6, 0x25, 0xa0, 0x6d, 0xc3, 0x9c, 0x10, 0x7e, 0xe7, 0x0d, 0x05, 0x7e, 0x4a,
+    0xdc, 0x38, 0x23, 0xf2, 0x25, 0xed, 0x06, 0x47, 0xd7, 0x9f, 0xcb, 0x35, 0x3e, 0x68, 0x85, 0x70,
+    0x53, 0x55, 0x16, 0x09, 0xe2, 0x95, 0x6e, 0x8d, 0x3d, 0x01, 0x1c, 0x2d, 0x47, 0x70, 0xfa, 0x2b,
+    0xf0, 0x86, 0x60, 0x76, 0x39, 0x1f, 0xfe, 0x20, 0xb9, 0x6a, 0xd7, 0x0b, 0x34, 0xbb, 0xf4, 0xf4,
+    0x10, 0x32, 0xbb, 0xaf, 0x25, 0x6c, 0xf2, 0xe8, 0x3c, 0x82, 0xb5, 0x54, 0x79, 0x74, 0x7a, 0x3e,
+    0x66, 0x4b, 0x7c, 0x67, 0xcf, 0xa7, 0xe3, 0x05, 0xcd, 0xb4, 0x25, 0x51, 0x27, 0xff, 0x5e, 0xcd,
+    0x98, 0xee, 0xf2, 0xbd, 0x9b, 0x6e, 0x7c, 0x54, 0xc8, 0xdc, 0xd9, 0x47, 0x33, 0x5c, 0xe8, 0x56,
+    0x91, 0xd9, 0xfa, 0xe5, 0x21, 0x1e, 0x9f, 0xd6, 0x48, 0x84, 0x66, 0xf8, 0xce, 0x4c, 0x45, 0x88,
+    0x0e, 0xa9, 0xf6, 0x03, 0xde, 0x56, 0x8d, 0x6a, 0xc9, 0x5d, 0x18, 0x8d, 0x8f, 0x67, 0xfe, 0x1b,
+    0x05, 0xad, 0xd0, 0xc0, 0xef, 0xb3, 0x2b, 0xf8, 0x13, 0xb7, 0x10, 0xdf, 0x34, 0xa8, 0x3a, 0xe7,
+    0x5f, 0xa2, 0x79, 0x6f, 0x09, 0xf7, 0x77, 0xd8, 0xe5, 0xf7, 0xd6, 0xd1, 0x74, 0xb7, 0x68, 0x36,
+    0x2e, 0x5b, 0x59, 0x1a, 0xb4, 0xf6, 0x9d, 0x8b, 0x5b, 0x1f, 0x14, 0x96, 0xef, 0xec, 0x2e, 0xa2,
+    0x94, 0x9b, 0xe9, 0x37, 0x61, 0x09, 0xae, 0xe7, 0x33, 0xb8, 0xdd, 0xaa, 0x22, 0x85, 0xcc, 0x36,
+    0x42, 0x79, 0xa8, 0xa2, 0x86, 0xa4, 0x6b, 0xb4, 0x2c, 0x71, 0x3e, 0xfe, 0x38, 0x78, 0x08, 0x5c,
+    0xb4, 0x44, 0x5a, 0x75, 0xb9, 0x82, 0x12, 0xf6, 0x1a, 0x59, 0x90, 0x02, 0x96, 0x2f, 0x07, 0xde,
+    0xb2, 0x34, 0xb2, 0x24, 0x60, 0xdf, 0x0a, 0x0c, 0x83, 0x57, 0x81, 0x20, 0x6a, 0x72, 0x0a, 0x2b,
+    0x6a, 0x59, 0xdc, 0xf1, 0xf2, 0x5c, 0x97, 0xeb, 0xe9, 0x78, 0xc8, 0x2b, 0xb2, 0x0d, 0x6e, 0x00,
+    0xd7, 0xfa, 0xfe, 0xf9, 0xd2, 0x59, 0xe2, 0x74, 0xea, 0x2d, 0x5b, 0x18, 0xd9, 0x50, 0xc8, 0x57,
+    0xb5, 0xca, 0x0b, 0x16, 0x7e, 0x8e, 0x65, 0x39, 0x84, 0x47, 0xe8, 0x34, 0x5a, 0xea, 0xa2, 0x5d,
+    0xf3, 0x41, 0x33, 0x5a, 0x22, 0x7d, 0xad, 0xd1, 0x99, 0x5f, 0xb6, 0x57, 0xa5, 0x03, 0x4d, 0xe0,
+    0xa9, 0x1f, 0x5a, 0x6b, 0x51, 0x7a, 0x81, 0xc3, 0xa3, 0x9f, 0xe0, 0x29, 0xa4, 0x62, 0x15, 0x0f,
+    0x12, 0xd1, 0xc8, 0xa4, 0xf0, 0x07, 0xc8, 0x60, 0x38, 0xe2, 0x3f, 0xae, 0x62, 0x03, 0xf9, 0x14,
+    0xcc, 0xe8, 0x3f, 0xab, 0x55, 0x3c, 0xec, 0x7c, 0x85, 0xf3, 0xed, 0x42, 0x81, 0x2b, 0x19, 0x74,
+    0x12, 0xe6, 0xa0, 0x8d, 0xa8, 0x5b, 0x84, 0x1c, 0x8a, 0x51, 0xe7, 0x9b, 0x3c, 0xc7, 0xd1, 0x43,
+    0x0f, 0x42, 0x0f, 0xbd, 0xd9, 0x20, 0x8a, 0x1e, 0x22, 0xb8, 0x7a, 0xa8, 0xae, 0x9f, 0x7b, 0xb0,
+    0xce, 0xd7, 0xc3, 0xb9, 0xbe, 0xeb, 0x81, 0x9c, 0xa3, 0x87, 0x08, 0xad, 0xd3, 0xc3, 0x04, 0x57,
+    0x0f, 0xd5, 0x75, 0x0d, 0xc3, 0xa4, 0x52, 0x68, 0xe6, 0xdc, 0x87, 0x1e, 0xca, 0xfe, 0x1d, 0xee,
+    0x69, 0x18, 0xac, 0x17, 0x3c, 0xef, 0x0f, 0xd2, 0x3d, 0x59, 0x2c, 0x63, 0x28, 0x05, 0x5f, 0x13,
+    0xf9, 0x33, 0xfe, 0x3a, 0xa2, 0xd2, 0x37, 0x88, 0x3c, 0xd9, 0x83, 0xe8, 0x21, 0xed, 0x13, 0x78,
+    0x98, 0x0a, 0x1c, 0xa5, 0xaf, 0x19, 0x3c, 0x40, 0x3a, 0x7e, 0xd2, 0x37, 0xf8, 0x3b, 0x80, 0x1c,
+    0x3f, 0xe9, 0x4b, 0xe6, 0x0e, 0xd3, 0x81, 0x9a, 0xf4, 0x35, 0x71, 0x3b, 0x12, 0x26, 0x47, 0x9b,
+    0x29, 0x71, 0x4c, 0x0c, 0x4e, 0x9e, 0xed, 0x99, 0xef, 0xca, 0x95, 0x2e, 0x53, 0x18, 0xcc, 0x6e,
+    0x6e, 0xe7, 0x83, 0x43, 0x12, 0x77, 0xaf, 0xa1, 0xb1, 0x29, 0x3c, 0x0e, 0x2e, 0xc2, 0xcd, 0x79,
+    0x3a, 0x67, 0x65, 0x0d, 0x18, 0x29, 0x9a, 0x86, 0xe5, 0xe3, 0xaf, 0xb5, 0xc4, 0xb5, 0xe3, 0xe0,
+    0xe9, 0x10, 0xe6, 0xee, 0xc1, 0x14, 0xfe, 0xb8, 0xbd, 0xb9, 0x1e, 0x59, 0x32, 0x52, 0x2d, 0x65,
+    0xb5, 0x8d, 0x1d, 0xd1, 0xc3, 0xfd, 0x1f, 0xea, 0xb5, 0xb3, 0x3b, 0x4c, 0xf6, 0xed, 0xbc, 0xb6,
+    0x4b, 0xdf, 0xd0, 0xac, 0x52, 0x34, 0xe4, 0x86, 0x2c, 0x99, 0xbd, 0x46, 0x26, 0x47, 0xff, 0xee,
+    0x5e, 0xc5, 0x3f, 0x90, 0x51, 0xc2, 0x5d, 0xe2, 0x80, 0x6e, 0xf3, 0x2f, 0x36, 0xcd, 0xeb, 0xee,
+    0xeb, 0x7f, 0xab, 0xb8, 0x17, 0x93, 0x6f, 0x56, 0xc9, 0xb7, 0xa1, 0x2b, 0x41, 0xb7, 0x14, 0x77,
+    0x05, 0x9f, 0xc0, 0xf8, 0xec, 0xec, 0xec, 0x55, 0xd5, 0x87, 0xed, 0xf8, 0xa3, 0xe5, 0x70, 0xa2,
+    0x64, 0xcd, 0xee, 0xb0, 0xaa, 0xb4, 0xa6, 0x68, 0xfa, 0x4b, 0xa1, 0x9b, 0xed, 0x04, 0x2e, 0x85,
+    0xb9, 0xe3, 0x1b, 0xf7, 0xb7, 0x8f, 0x59, 0xd2, 0xb8, 0xf7, 0x46, 0x78, 0x68, 0xf0, 0x73, 0xc2,
+    0x3f, 0x8a, 0xfe, 0x07, 0x1a, 0x24, 0x9a, 0xce, 0x2c, 0x09, 0x00, 0x00,
+};
+const WebAsset ASSET_CONFIG_HTML = { "text/html", ASSET_CONFIG_HTML_GZ, sizeof(ASSET_CONFIG_HTML_GZ), "\"9e2d38707d0459c1\"" };
+
+// diag.html
+static const uint8_t ASSET_DIAG_HTML_GZ[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x9d, 0x59, 0x5b, 0x53, 0xdc, 0xb8,
+    0x12, 0x7e, 0xdf, 0x5f, 0xa1, 0x38, 0x5b, 0xf1, 0x4c, 0x2d, 0x78, 0x80, 0x84, 0x90, 0xcc, 0x2d,
+    0xb5, 0x5c, 0x72, 0x96, 0x5d, 0x48, 0x28, 0x86, 0x7d, 0xd8, 0xaa, 0xad, 0xa2, 0x64, 0x5b, 0x33,
+    0x16, 0xf8, 0x76, 0x24, 0x79, 0x80, 0x93, 0xe5, 0xbf, 0x9f, 0x6e, 0x49, 0xbe, 0x8e, 0xb9, 0x9c,
+    0x93, 0x17, 0x3c, 0x72, 0x77, 0xab, 0xbb, 0xf5, 0x75, 0xf7, 0x27, 0x67, 0xfa, 0xe6, 0xf8, 0xfb,
+    0xd1, 0xd5, 0x5f, 0x17, 0x27, 0x24, 0x52, 0x49, 0x3c, 0xff, 0x69, 0x5a, 0xfe, 0x61, 0x34, 0x9c,
+    0xff, 0x44, 0xc8, 0x54, 0x71, 0x15, 0xb3, 0xf9, 0x59, 0xb6, 0x66, 0x87, 0x0f, 0x8a, 0x91, 0x63,
+    0x4e, 0x57, 0x69, 0x26, 0x15, 0x0f, 0xe4, 0x74, 0x64, 0xde, 0xa1, 0x54, 0xc2, 0x14, 0x25, 0x29,
+    0x4d, 0xd8, 0xcc, 0x59, 0x73, 0x76, 0x97, 0x67, 0x42, 0x39, 0x24, 0xc8, 0x52, 0xc5, 0x52, 0x35,
+    0x73, 0xee, 0x78, 0xa8, 0xa2, 0xd9, 0xfb, 0x8f, 0x3b, 0x5b, 0x84, 0xa7, 0x5c, 0x71, 0x1a, 0x6f,
+    0xcb, 0x80, 0xc6, 0x6c, 0xb6, 0xeb, 0x68, 0xed, 0x98, 0xa7, 0xb7, 0x44, 0xb0, 0x78, 0xe6, 0x48,
+    0xf5, 0x10, 0x33, 0x19, 0x31, 0x06, 0xea, 0x91, 0x60, 0xcb, 0x99, 0x33, 0x8a, 0xfd, 0x91, 0x5e,
+    0xf5, 0x02, 0x29, 0x41, 0x7c, 0x3a, 0x32, 0xae, 0x4d, 0xfd, 0x2c, 0x7c, 0xd0, 0xda, 0x3c, 0x59,
+    0x91, 0x20, 0xa6, 0x52, 0xce, 0x9c, 0x38, 0x5b, 0x65, 0x0e, 0x91, 0x22, 0x00, 0x3d, 0xc1, 0xe4,
+    0x48, 0xe6, 0xb0, 0x1e, 0x79, 0x37, 0xf9, 0xca, 0x21, 0x34, 0x06, 0x4f, 0xaa, 0x38, 0xce, 0x50,
+    0x52, 0xab, 0x47, 0x7b, 0xf3, 0x56, 0x50, 0xf0, 0x1b, 0x97, 0x43, 0xbe, 0x2e, 0xad, 0x4a, 0x16,
+    0x28, 0x9e, 0xa5, 0x5a, 0x1c, 0xde, 0xf8, 0xf3, 0xa3, 0x88, 0xe7, 0xe3, 0xe9, 0xc8, 0x9f, 0x93,
+    0x93, 0xc5, 0xc5, 0xfb, 0x3d, 0x32, 0x95, 0x39, 0x4d, 0x09, 0x0f, 0x67, 0x4e, 0x00, 0x6f, 0x9c,
+    0xf9, 0x74, 0x84, 0x0b, 0xf3, 0xa9, 0x2f, 0x2a, 0x95, 0x4b, 0xb6, 0xe6, 0x12, 0x8c, 0x18, 0xb5,
+    0x5a, 0x41, 0xb0, 0x75, 0xaf, 0x3c, 0x6e, 0x41, 0x4e, 0x8f, 0xbb, 0xe2, 0x68, 0x9f, 0x87, 0xbd,
+    0x1a, 0x5f, 0x05, 0x63, 0xe4, 0xf2, 0xd7, 0xf3, 0xae, 0x0a, 0xa4, 0xab, 0x76, 0x89, 0xfc, 0x71,
+    0xb8, 0xa1, 0x73, 0xb1, 0xe8, 0xd1, 0xca, 0xa5, 0xa0, 0xc9, 0x53, 0x6a, 0xe7, 0x3c, 0x25, 0x4f,
+    0x6d, 0x97, 0xf0, 0xf4, 0xb9, 0x1d, 0xff, 0xcc, 0x15, 0x4f, 0x58, 0x57, 0xa9, 0xd0, 0xab, 0xb5,
+    0x0e, 0x64, 0xbc, 0xa9, 0x74, 0x76, 0xb2, 0x91, 0x88, 0x98, 0x85, 0xf2, 0x0e, 0x8e, 0x1a, 0x91,
+    0x31, 0x73, 0x42, 0x8e, 0x27, 0xfd, 0x30, 0xe6, 0x29, 0x40, 0x89, 0x6d, 0xfb, 0x71, 0x16, 0xdc,
+    0x4e, 0x34, 0xea, 0xc6, 0xbb, 0x1f, 0xf2, 0xfb, 0x49, 0xc4, 0xf8, 0x2a, 0x52, 0xe6, 0xd9, 0xcf,
+    0x44, 0xc8, 0xc4, 0xb6, 0xa0, 0x21, 0x2f, 0xe4, 0xf8, 0x00, 0x56, 0xd6, 0x4c, 0xc0, 0xd1, 0x03,
+    0x28, 0x69, 0xcc, 0x57, 0xe9, 0x38, 0xe1, 0x61, 0x18, 0xb3, 0x89, 0x4f, 0x83, 0xdb, 0x95, 0xc8,
+    0x8a, 0x34, 0x1c, 0xbf, 0xdd, 0xd9, 0xd9, 0xa9, 0x9d, 0x6b, 0x39, 0x11, 0xb1, 0xfb, 0x9e, 0xd3,
+    0x88, 0xa9, 0xcf, 0xe2, 0xf9, 0x19, 0x5f, 0x33, 0x52, 0xe4, 0x21, 0x55, 0x18, 0xb0, 0x59, 0x33,
+    0xef, 0x25, 0x8b, 0x01, 0x53, 0x06, 0x00, 0xf0, 0xd6, 0x22, 0x0b, 0x5e, 0x64, 0x39, 0x22, 0x8d,
+    0xac, 0x69, 0x5c, 0x40, 0x58, 0x7b, 0xfb, 0xb0, 0xed, 0x07, 0x32, 0xd2, 0xf9, 0x18, 0x99, 0x77,
+    0x4f, 0x88, 0xee, 0xa2, 0x8b, 0xc4, 0xd8, 0x65, 0xe1, 0x7c, 0xf7, 0x55, 0x4a, 0xfb, 0x3a, 0x2e,
+    0x06, 0xf1, 0x3f, 0x90, 0xfd, 0x4d, 0x79, 0x08, 0x4b, 0xdb, 0x6b, 0x85, 0x0c, 0x31, 0x39, 0xf3,
+    0x77, 0x6f, 0x3f, 0x7f, 0x3c, 0xf8, 0x3c, 0xb1, 0x71, 0x63, 0xb9, 0x8c, 0xa0, 0x5e, 0x9e, 0xaa,
+    0x1b, 0xad, 0x28, 0x01, 0xb5, 0x67, 0x19, 0x24, 0x3d, 0x5d, 0x79, 0x9e, 0xf7, 0xac, 0xfc, 0xdc,
+    0xe6, 0x6f, 0x71, 0x4c, 0x0e, 0x59, 0x1a, 0x44, 0x09, 0x15, 0xb7, 0x4f, 0x27, 0xd0, 0x47, 0x91,
+    0xeb, 0x5b, 0xdf, 0x79, 0x32, 0x33, 0x7b, 0x1f, 0x1c, 0x48, 0xc8, 0xf9, 0xe1, 0x0b, 0xd9, 0xd8,
+    0xdb, 0xf9, 0xf0, 0xa9, 0x91, 0xc2, 0xbd, 0x97, 0x35, 0x3e, 0xed, 0x7e, 0xde, 0x73, 0xe6, 0x9f,
+    0x36, 0x04, 0xab, 0xc4, 0x59, 0x00, 0x17, 0x4a, 0x81, 0x92, 0x8d, 0xd2, 0x57, 0x36, 0x23, 0xc6,
+    0x71, 0x51, 0x40, 0xc0, 0x97, 0x45, 0x0a, 0xf8, 0xd6, 0x62, 0x56, 0xa7, 0x91, 0x96, 0x65, 0xcc,
+    0xa5, 0x6a, 0xa8, 0x20, 0xde, 0xca, 0xec, 0xbd, 0x98, 0xf6, 0x3b, 0xbe, 0xe4, 0xff, 0x73, 0xe2,
+    0xa1, 0xde, 0xc8, 0xa1, 0xc0, 0x92, 0x49, 0x99, 0x94, 0x55, 0xea, 0x6b, 0x7c, 0xf3, 0x34, 0x2f,
+    0x14, 0x51, 0x0f, 0x39, 0x43, 0x00, 0xa7, 0x2b, 0xe6, 0x94, 0xf5, 0x70, 0xed, 0x6b, 0x3d, 0x87,
+    0x40, 0x1f, 0x80, 0xdc, 0xc3, 0x5f, 0x7a, 0x8f, 0x40, 0xde, 0x77, 0x6a, 0x50, 0xef, 0x97, 0x9d,
+    0xb4, 0x59, 0x48, 0x56, 0xf1, 0x5a, 0x6f, 0x55, 0x95, 0xd4, 0x4b, 0x31, 0x96, 0x1e, 0x5f, 0x31,
+    0xa9, 0xc8, 0x42, 0x51, 0xa8, 0x63, 0x72, 0x94, 0xc5, 0x99, 0x78, 0xc1, 0xe9, 0x00, 0x65, 0x8c,
+    0xd3, 0xf6, 0xd1, 0x7a, 0xf7, 0x76, 0xa9, 0xff, 0x39, 0xcf, 0x1f, 0x9d, 0x64, 0xea, 0x5a, 0xea,
+    0xdd, 0x9c, 0xf9, 0x82, 0xb5, 0x77, 0x6e, 0x1e, 0xe4, 0xeb, 0x7d, 0xff, 0x8d, 0x51, 0xa1, 0x7c,
+    0x46, 0xd5, 0xeb, 0x1d, 0x8f, 0x4a, 0x95, 0xeb, 0x8d, 0x10, 0x76, 0x76, 0xea, 0x24, 0x1b, 0x6b,
+    0x17, 0x45, 0x2c, 0x59, 0xe3, 0x28, 0x9b, 0x36, 0xd3, 0x22, 0xf1, 0x59, 0x8f, 0xd1, 0x22, 0xc5,
+    0x21, 0x6e, 0x9d, 0x4e, 0x68, 0x1c, 0x77, 0x4e, 0x75, 0x77, 0xa7, 0x3e, 0xd4, 0x17, 0x12, 0xa6,
+    0xe0, 0x70, 0x57, 0x4c, 0x5c, 0x47, 0x50, 0xa6, 0x57, 0xe6, 0xb9, 0x0e, 0xf9, 0xf5, 0x19, 0x6b,
+    0x46, 0xb4, 0x60, 0x69, 0x48, 0x74, 0xee, 0xce, 0x01, 0xa4, 0x74, 0xc5, 0x7a, 0x32, 0xa7, 0xd8,
+    0xbd, 0xa2, 0x82, 0x51, 0xe3, 0x03, 0xc8, 0x26, 0x12, 0x98, 0x00, 0x8c, 0x8a, 0x80, 0x45, 0x59,
+    0x0c, 0x63, 0x60, 0xe6, 0x5c, 0x41, 0x0a, 0x08, 0x25, 0xf8, 0x92, 0x24, 0xc6, 0x10, 0xa2, 0xaf,
+    0xd4, 0x6c, 0x8e, 0xd8, 0xa7, 0xb0, 0x90, 0x86, 0xd7, 0xa5, 0xed, 0x4d, 0xaf, 0xaa, 0xe0, 0xd0,
+    0x50, 0x77, 0x42, 0xd4, 0xd2, 0xa7, 0x09, 0xc8, 0x8e, 0xfe, 0x75, 0xfa, 0xb5, 0x27, 0x8a, 0x65,
+    0x26, 0x12, 0xbd, 0x15, 0x30, 0x9d, 0x22, 0x8f, 0xa1, 0x96, 0x1d, 0x02, 0x8d, 0xc0, 0x1c, 0x5e,
+    0x52, 0xc4, 0x8a, 0xe7, 0x90, 0xc9, 0x11, 0x8a, 0x6d, 0xc3, 0xb0, 0xa1, 0x75, 0x27, 0x6c, 0x9e,
+    0xf2, 0x92, 0xc7, 0x50, 0xa6, 0x86, 0xa3, 0x99, 0x67, 0x1a, 0x04, 0x2c, 0x57, 0x68, 0x16, 0xf7,
+    0xbe, 0xc9, 0xd9, 0x6a, 0xcb, 0x3c, 0xae, 0xf8, 0xd2, 0x01, 0x3e, 0xf6, 0xef, 0x82, 0x0b, 0x68,
+    0x84, 0x2d, 0xc7, 0x3b, 0x46, 0x23, 0x98, 0x95, 0xcc, 0x26, 0x42, 0xb0, 0x00, 0xc8, 0x09, 0x43,
+    0xd0, 0x98, 0x5d, 0x1a, 0x0b, 0x16, 0x26, 0xb5, 0x67, 0x3d, 0xc9, 0x34, 0x16, 0x65, 0xe1, 0x27,
+    0x5c, 0xd9, 0x44, 0x56, 0x59, 0xe9, 0x74, 0x47, 0x1d, 0x6b, 0x1b, 0x2e, 0x79, 0xd5, 0x2e, 0xb3,
+    0x0c, 0xd4, 0xdf, 0x05, 0x59, 0xfe, 0x30, 0x21, 0xc7, 0x30, 0x3a, 0xb2, 0x94, 0x7d, 0x7a, 0x3f,
+    0x1d, 0xe5, 0x5a, 0x4c, 0x06, 0x82, 0xe7, 0xb6, 0x31, 0x2f, 0x8b, 0x54, 0xe3, 0x8a, 0xfc, 0x3c,
+    0xe0, 0xe1, 0x90, 0xfc, 0x80, 0x90, 0x55, 0x21, 0x52, 0x12, 0x66, 0x41, 0x91, 0x80, 0xdb, 0xde,
+    0x8a, 0xa9, 0x93, 0x98, 0xe1, 0xe3, 0xe1, 0xc3, 0x69, 0x88, 0x42, 0x13, 0xf2, 0xd8, 0x56, 0x65,
+    0x32, 0x18, 0x48, 0xd4, 0x5d, 0x53, 0x41, 0x42, 0x32, 0xab, 0x95, 0x03, 0x40, 0x8f, 0x62, 0x56,
+    0x7f, 0xe0, 0x82, 0x9f, 0x2e, 0xa8, 0x87, 0x1e, 0x4f, 0x53, 0x26, 0xae, 0x00, 0x5e, 0x20, 0x2c,
+    0x27, 0xd5, 0x9e, 0x66, 0xfd, 0xb7, 0xab, 0xf3, 0xb3, 0x8d, 0x3d, 0x72, 0xa0, 0xa6, 0xbf, 0xcb,
+    0x2c, 0x1d, 0x14, 0x22, 0xde, 0x22, 0x99, 0x7f, 0x03, 0xfb, 0xd9, 0x3c, 0x5a, 0xed, 0x25, 0x53,
+    0x41, 0x64, 0x5e, 0x97, 0x6f, 0x08, 0xa0, 0x59, 0x45, 0x59, 0x38, 0x26, 0xee, 0xc5, 0xf7, 0xc5,
+    0x95, 0xbb, 0x55, 0xad, 0x23, 0x7f, 0x66, 0x42, 0x8e, 0xc9, 0x0f, 0xf7, 0xc8, 0x30, 0xf4, 0x6d,
+    0x2c, 0x02, 0x17, 0x24, 0x69, 0x9e, 0xc7, 0xc0, 0x84, 0x70, 0xd7, 0xd1, 0x0d, 0xec, 0xe8, 0x3e,
+    0xd6, 0x6a, 0xc8, 0xb7, 0xc7, 0xe4, 0xf7, 0xc5, 0xf7, 0x6f, 0x9e, 0x84, 0x72, 0x4e, 0x01, 0x24,
+    0x0f, 0x03, 0x74, 0xc6, 0x4a, 0x3c, 0x0e, 0x27, 0xfa, 0xa9, 0xe3, 0x7c, 0xe2, 0x0f, 0xfc, 0x46,
+    0x6e, 0xcf, 0xa9, 0x8a, 0xbc, 0x65, 0x9c, 0x65, 0x62, 0xe0, 0x03, 0x47, 0xd9, 0x85, 0x99, 0xbb,
+    0x7f, 0xf0, 0x51, 0xe7, 0xd5, 0xe8, 0xe9, 0x48, 0xdc, 0x11, 0xcd, 0x39, 0x1c, 0x2d, 0x5d, 0xb9,
+    0x43, 0x4f, 0x45, 0x2c, 0x1d, 0x08, 0x32, 0x9b, 0x13, 0xe1, 0xa1, 0x53, 0x83, 0xa1, 0x5d, 0x0b,
+    0x71, 0xad, 0x8c, 0xf7, 0xe7, 0x81, 0x8b, 0xe4, 0x18, 0xe4, 0x9b, 0x09, 0x0e, 0x3d, 0x5c, 0x9c,
+    0xd4, 0x32, 0xc0, 0xb7, 0x37, 0x44, 0x60, 0x6d, 0xd2, 0xb6, 0xc2, 0xc3, 0x0d, 0x21, 0x1e, 0x36,
+    0x64, 0x90, 0xe1, 0x76, 0x24, 0x1a, 0x81, 0x85, 0x1e, 0xbe, 0xd7, 0xd1, 0xed, 0x7d, 0x18, 0x36,
+    0xd4, 0x34, 0xa9, 0x7e, 0x4e, 0x4f, 0x0b, 0xf4, 0x28, 0x1a, 0x7e, 0xfc, 0x9c, 0xa6, 0x91, 0xd0,
+    0xaa, 0x3b, 0x3b, 0xa0, 0x6a, 0x75, 0x11, 0x95, 0x12, 0x61, 0xe9, 0xba, 0xa5, 0x39, 0xbe, 0x24,
+    0x20, 0x2f, 0x61, 0x33, 0xb8, 0x21, 0xc1, 0xe1, 0x0f, 0x1b, 0x90, 0x01, 0xd1, 0x5f, 0x40, 0x16,
+    0xef, 0x1f, 0x54, 0x84, 0xe4, 0xc2, 0x48, 0x18, 0xee, 0xfd, 0x17, 0x93, 0xd8, 0x05, 0x2a, 0x3b,
+    0x95, 0xf4, 0x82, 0xff, 0x87, 0x01, 0x76, 0xc8, 0x2f, 0x78, 0xd6, 0xda, 0xb2, 0x84, 0x95, 0x21,
+    0xfc, 0x76, 0x91, 0x19, 0xf5, 0xea, 0xfc, 0x29, 0x59, 0xd8, 0xd6, 0x29, 0x60, 0xa5, 0xd4, 0xc1,
+    0x75, 0xb3, 0xca, 0xee, 0x29, 0xd0, 0xbc, 0x2f, 0xe0, 0x3e, 0x41, 0xf1, 0x01, 0xb4, 0x4a, 0x68,
+    0x51, 0x8a, 0x0d, 0x5d, 0x2d, 0xdb, 0x6f, 0x1c, 0xaf, 0x26, 0x6d, 0xe3, 0x2a, 0x53, 0x34, 0x26,
+    0xdb, 0x64, 0x63, 0xa7, 0x7e, 0x03, 0x53, 0x3d, 0xed, 0xe6, 0x47, 0x38, 0x01, 0x59, 0xa8, 0x2d,
+    0x69, 0x4d, 0x68, 0x46, 0x5a, 0x4f, 0x12, 0xba, 0xca, 0x80, 0xa1, 0x68, 0xa9, 0x5e, 0x13, 0x4e,
+    0x63, 0x7c, 0xb9, 0x9a, 0xc0, 0xb9, 0x73, 0xbc, 0x6f, 0x41, 0xdf, 0x95, 0x3a, 0x9d, 0xd3, 0x22,
+    0x9e, 0x3b, 0xb5, 0x96, 0x36, 0x8f, 0x5d, 0x59, 0x7a, 0xd0, 0xda, 0x4e, 0x28, 0xd4, 0xc0, 0xb2,
+    0x89, 0xee, 0xa6, 0x73, 0x31, 0x9f, 0xa3, 0x47, 0xd8, 0x79, 0x96, 0x5e, 0x8a, 0x91, 0xc0, 0xdf,
+    0xb0, 0x91, 0x24, 0x7c, 0xbb, 0xf4, 0xa4, 0x76, 0xd5, 0x87, 0xcb, 0xae, 0x2c, 0xb3, 0x35, 0x42,
+    0xd5, 0x7a, 0xd3, 0xc7, 0xe1, 0x66, 0xe4, 0x23, 0xf0, 0xcb, 0x34, 0xd5, 0x9e, 0x98, 0xf4, 0x20,
+    0xa2, 0xba, 0xae, 0x67, 0x2e, 0x5e, 0xcc, 0xb1, 0x42, 0x75, 0x2f, 0xa6, 0xca, 0xb5, 0xfd, 0x66,
+    0x66, 0xda, 0x0d, 0xc9, 0x52, 0xd3, 0xc9, 0x67, 0xae, 0xad, 0xfc, 0x20, 0x4b, 0x97, 0x5c, 0x24,
+    0x83, 0xbf, 0x9d, 0x4b, 0x06, 0x79, 0x7b, 0x20, 0x46, 0x8f, 0x2c, 0x8e, 0xbf, 0x90, 0xc1, 0xb7,
+    0x0c, 0xc8, 0x7c, 0x92, 0x9b, 0x66, 0x09, 0xc7, 0xf3, 0xb7, 0x33, 0xc4, 0x84, 0x35, 0x87, 0x84,
+    0x0b, 0x43, 0xc2, 0x9d, 0x7f, 0x2d, 0x95, 0x08, 0x22, 0xb4, 0x1e, 0xae, 0x66, 0x22, 0x54, 0x19,
+    0x7d, 0x24, 0x0c, 0xf8, 0xce, 0x2b, 0x91, 0xfd, 0x2d, 0x6b, 0x9d, 0xe1, 0x63, 0x5d, 0x77, 0xb2,
+    0xea, 0x03, 0xd8, 0x98, 0xb1, 0x61, 0x87, 0xad, 0xd2, 0xba, 0xd3, 0xad, 0x01, 0x39, 0x76, 0xa3,
+    0x58, 0xf1, 0x67, 0x47, 0xed, 0xce, 0x83, 0xe8, 0x53, 0x7d, 0xaf, 0xa8, 0x3c, 0xfa, 0xa2, 0xbd,
+    0x59, 0x2c, 0xca, 0x4b, 0x7e, 0x79, 0xa6, 0x77, 0x9e, 0x94, 0x3c, 0xac, 0xe0, 0x0d, 0x32, 0xa7,
+    0x17, 0xb5, 0xc4, 0x9d, 0xc7, 0xf3, 0xc6, 0xab, 0x4b, 0xd0, 0xdf, 0xf8, 0xa4, 0x00, 0xfa, 0xce,
+    0xdc, 0x08, 0xe3, 0xb3, 0x39, 0x7a, 0x73, 0x77, 0x0d, 0x0f, 0x13, 0xab, 0x79, 0xfe, 0xeb, 0x51,
+    0xd3, 0x6a, 0x42, 0x83, 0xaa, 0xa0, 0x2a, 0x17, 0x01, 0x4d, 0x78, 0x30, 0x95, 0xef, 0x36, 0x4d,
+    0x75, 0xa8, 0x35, 0x6f, 0x87, 0x80, 0xf5, 0x8c, 0xd7, 0x09, 0x81, 0x65, 0xcf, 0x9f, 0xf4, 0x89,
+    0x19, 0x7a, 0xbf, 0xd1, 0x5c, 0xbb, 0x0a, 0x15, 0x73, 0x68, 0x99, 0x0d, 0xd9, 0x9a, 0x07, 0xcc,
+    0x4e, 0x99, 0xb2, 0xc7, 0x8d, 0x46, 0x44, 0xdf, 0xb3, 0x15, 0x43, 0xf0, 0x28, 0x01, 0x33, 0x8a,
+    0x41, 0xf9, 0x10, 0xb8, 0xd5, 0xa6, 0x0a, 0x50, 0x08, 0x40, 0x0b, 0xa8, 0x10, 0x9c, 0x49, 0x02,
+    0x43, 0x83, 0x2c, 0x39, 0x8b, 0x43, 0x7c, 0x04, 0x10, 0x05, 0x11, 0x5e, 0x5d, 0xcc, 0x89, 0xe0,
+    0x69, 0x82, 0xc8, 0x8c, 0xa4, 0xec, 0x8e, 0x9c, 0xa0, 0xee, 0x22, 0x2b, 0x44, 0xc0, 0xec, 0x28,
+    0xd2, 0xd6, 0xa4, 0x6b, 0x0b, 0x06, 0xaa, 0x94, 0x86, 0xa1, 0x96, 0x3a, 0x83, 0xd2, 0x66, 0x10,
+    0xca, 0xc0, 0x55, 0xee, 0x56, 0x35, 0xf5, 0x06, 0xac, 0xee, 0xaa, 0x68, 0x19, 0xa3, 0xd4, 0x93,
+    0x13, 0x88, 0x9a, 0x64, 0x03, 0xe6, 0x21, 0x4d, 0x1b, 0x36, 0x3b, 0xb2, 0x1b, 0xb9, 0x84, 0xa7,
+    0x04, 0xba, 0xf1, 0x8b, 0xe3, 0x45, 0x79, 0x51, 0x77, 0x44, 0x68, 0x0b, 0x49, 0xc3, 0x82, 0xfd,
+    0x0a, 0xf3, 0x9c, 0x91, 0xa4, 0xd7, 0x48, 0xde, 0x30, 0xf2, 0xc2, 0xb8, 0x52, 0x5e, 0xde, 0x6b,
+    0xa2, 0x68, 0x98, 0xe8, 0x1d, 0x5c, 0xca, 0x2b, 0x5a, 0x0a, 0x71, 0xa9, 0xf0, 0xc3, 0x82, 0x45,
+    0xde, 0x81, 0x86, 0xf9, 0xe8, 0x57, 0x7f, 0x85, 0xc1, 0x21, 0xf6, 0x16, 0xc1, 0xaa, 0xbc, 0x78,
+    0x62, 0x05, 0x23, 0x76, 0xdf, 0xb1, 0xdd, 0x10, 0x79, 0x6c, 0xee, 0x21, 0xcc, 0x1e, 0xe4, 0xdd,
+    0x3b, 0x8d, 0x2f, 0x28, 0x0b, 0x77, 0x38, 0xac, 0x1f, 0x3b, 0xfe, 0x89, 0x26, 0x78, 0x01, 0x5d,
+    0x95, 0x3b, 0xfa, 0xa6, 0xa5, 0xb7, 0x39, 0x58, 0x1e, 0xb8, 0x35, 0x14, 0x2d, 0x2a, 0x80, 0x6a,
+    0x0a, 0xa1, 0x05, 0x2a, 0x24, 0x94, 0x51, 0xf5, 0x5b, 0x59, 0x1e, 0x80, 0x15, 0xf2, 0x68, 0x0c,
+    0xa0, 0x37, 0x30, 0xdb, 0x40, 0x2c, 0x4b, 0x0d, 0x36, 0xbb, 0x86, 0x2a, 0x26, 0x68, 0x50, 0x59,
+    0x61, 0x1e, 0xa0, 0xf7, 0x23, 0x01, 0x46, 0xa7, 0xe1, 0x75, 0x0a, 0x74, 0xb3, 0x36, 0xa5, 0xcb,
+    0x67, 0x0b, 0x8e, 0x69, 0xf8, 0x38, 0xd4, 0x3b, 0x55, 0x70, 0x97, 0x31, 0x07, 0x1e, 0x08, 0x5b,
+    0x74, 0x0a, 0xd9, 0x38, 0x63, 0xde, 0x82, 0x27, 0x86, 0xee, 0xf7, 0x44, 0xf4, 0x7c, 0x51, 0x5b,
+    0x7d, 0xbd, 0x7d, 0x15, 0x61, 0x65, 0xf4, 0x55, 0xe1, 0xc1, 0x0e, 0x23, 0xbf, 0xfa, 0x0c, 0x81,
+    0x31, 0xfa, 0xe3, 0x96, 0x5d, 0x1b, 0x51, 0xd9, 0xac, 0xab, 0x4b, 0xb9, 0xc9, 0x20, 0x30, 0xd9,
+    0xdb, 0xce, 0x0e, 0xf6, 0x54, 0x7b, 0xf6, 0xb1, 0x8a, 0xb0, 0x47, 0x30, 0xd6, 0x2c, 0x10, 0x8f,
+    0xa8, 0x4c, 0x1f, 0x30, 0x44, 0x7d, 0x67, 0x1c, 0x00, 0xba, 0xb6, 0x60, 0xcc, 0x0e, 0x2b, 0xae,
+    0x5b, 0x6d, 0x5e, 0x5f, 0x70, 0xff, 0x8f, 0xcd, 0xab, 0x4b, 0x77, 0xbd, 0x7f, 0xe7, 0x72, 0xff,
+    0xa4, 0x27, 0x5b, 0x24, 0xdf, 0x90, 0x2f, 0xea, 0xbe, 0xb9, 0xe9, 0x68, 0xf3, 0xba, 0xfa, 0x92,
+    0xab, 0x88, 0x12, 0x10, 0x33, 0x10, 0xa9, 0x75, 0x8c, 0x27, 0x10, 0x71, 0x32, 0x68, 0x55, 0xfe,
+    0x1b, 0x78, 0x8d, 0xc7, 0x48, 0x63, 0x26, 0xd4, 0xc0, 0xb9, 0x88, 0x19, 0x85, 0x19, 0x8c, 0x03,
+    0x5d, 0x74, 0x6e, 0xd8, 0x9e, 0x33, 0x2c, 0x6f, 0x3e, 0x75, 0x9d, 0x76, 0x12, 0x63, 0x45, 0x47,
+    0xa8, 0x87, 0x79, 0xc1, 0x1b, 0xf9, 0x18, 0xdd, 0x79, 0x6c, 0x5f, 0x09, 0x70, 0xbd, 0xba, 0x12,
+    0x28, 0x4d, 0x9a, 0xac, 0x07, 0x0a, 0xe1, 0xd1, 0x4e, 0x40, 0x75, 0x2d, 0xd1, 0x5f, 0xd2, 0x2e,
+    0xb2, 0x38, 0x6e, 0x84, 0xdb, 0xbc, 0x7b, 0xc8, 0x50, 0x4b, 0x3c, 0x77, 0xfd, 0xf0, 0xdb, 0x04,
+    0x0d, 0x33, 0xe0, 0x7b, 0x88, 0x23, 0xc0, 0x35, 0xd4, 0x76, 0x0e, 0x89, 0x86, 0x5b, 0x92, 0x4b,
+    0xfe, 0xf9, 0x87, 0x34, 0xd7, 0x45, 0x91, 0xa6, 0xb8, 0x3e, 0x6c, 0x91, 0x3b, 0x48, 0x70, 0xb9,
+    0x61, 0xab, 0x9d, 0x5d, 0x1a, 0x69, 0x43, 0xea, 0x7c, 0xef, 0xd6, 0xd7, 0xac, 0xee, 0x8f, 0xc3,
+    0xa1, 0xe7, 0x79, 0x0d, 0x86, 0x06, 0xa5, 0xc5, 0xd4, 0x15, 0xb4, 0xda, 0xac, 0x50, 0x83, 0x2a,
+    0xb6, 0xad, 0xf2, 0x36, 0x50, 0x8b, 0xd9, 0xa4, 0xd7, 0x1c, 0xf0, 0xa7, 0xae, 0x07, 0xf8, 0x45,
+    0x12, 0xbc, 0x08, 0xb9, 0xa4, 0x3e, 0x80, 0x13, 0x91, 0x41, 0x81, 0x4b, 0x4d, 0x9e, 0x0c, 0x94,
+    0x87, 0x31, 0x34, 0x9a, 0x0d, 0xcb, 0xdd, 0x88, 0x2c, 0x15, 0x6a, 0xa9, 0x2e, 0x29, 0x50, 0xde,
+    0xd0, 0xb5, 0x5c, 0xe8, 0xab, 0xfe, 0xa5, 0xd9, 0x31, 0x12, 0x0d, 0xa4, 0x1f, 0x48, 0x5c, 0x1b,
+    0xde, 0xfb, 0x80, 0x7f, 0x59, 0xc4, 0x4a, 0x02, 0x5f, 0xc9, 0x07, 0xf7, 0x78, 0x00, 0x48, 0x99,
+    0xee, 0x3d, 0xfc, 0xe0, 0xa0, 0x29, 0x93, 0xe1, 0xfd, 0xf7, 0x90, 0xa8, 0x5c, 0xda, 0x54, 0x8d,
+    0x60, 0x6e, 0x7b, 0x37, 0x19, 0x07, 0x60, 0x69, 0xbb, 0x55, 0x3e, 0x00, 0x48, 0x70, 0xd7, 0x85,
+    0x23, 0x07, 0x0c, 0x68, 0xd8, 0xbc, 0x94, 0x82, 0xce, 0x1d, 0xb7, 0x23, 0xfe, 0x6c, 0x29, 0x3d,
+    0x6d, 0x5a, 0x89, 0xa2, 0x4a, 0x6e, 0x0f, 0x02, 0xbf, 0xdc, 0xfa, 0x33, 0x0c, 0xa9, 0x32, 0x70,
+    0xeb, 0xd7, 0x5d, 0xfd, 0x47, 0xfb, 0x8e, 0x5f, 0x56, 0x46, 0x05, 0x80, 0x36, 0xf8, 0x1b, 0x98,
+    0xb7, 0x63, 0x00, 0x8c, 0x56, 0xdf, 0x94, 0x74, 0x04, 0x86, 0xb3, 0x37, 0x43, 0x68, 0x30, 0x19,
+    0x86, 0x57, 0x46, 0x24, 0x3d, 0xc7, 0x6c, 0x49, 0xe1, 0x14, 0xea, 0xea, 0xc7, 0x46, 0xb1, 0x0c,
+    0x2d, 0x7b, 0x42, 0x8a, 0x7e, 0x0c, 0xfc, 0x66, 0xa0, 0x22, 0x2e, 0x2b, 0x11, 0xe0, 0x69, 0x0b,
+    0x25, 0x28, 0x76, 0x73, 0xa2, 0x32, 0x82, 0xef, 0x88, 0x21, 0x74, 0xae, 0x44, 0x3a, 0x1f, 0x20,
+    0x2d, 0xa7, 0x30, 0xe6, 0x65, 0x00, 0xd7, 0x37, 0x68, 0x0b, 0x69, 0x06, 0x98, 0x16, 0x6b, 0xe8,
+    0x1d, 0x66, 0xfc, 0x43, 0xbf, 0xc9, 0x7b, 0xd2, 0x64, 0x9c, 0xff, 0x22, 0xa3, 0xec, 0x6e, 0xb6,
+    0xeb, 0x6e, 0xa4, 0x64, 0xcb, 0x7e, 0xb7, 0x58, 0x86, 0x8f, 0xc3, 0x0a, 0x48, 0x4f, 0xd7, 0xf4,
+    0x0d, 0xae, 0x99, 0xee, 0x71, 0xa3, 0x71, 0x5a, 0x00, 0x27, 0x44, 0xa4, 0x9a, 0x6d, 0x2c, 0x56,
+    0xf5, 0x67, 0x29, 0x82, 0x17, 0x88, 0x37, 0x1a, 0xa5, 0x06, 0xb8, 0x06, 0x7a, 0x37, 0x9e, 0xa6,
+    0x00, 0xc3, 0x66, 0xea, 0x81, 0x7d, 0xdb, 0xcf, 0x4e, 0x00, 0x6e, 0xfd, 0xdf, 0x96, 0xd3, 0x91,
+    0xf9, 0x7f, 0xd6, 0xff, 0x02, 0x1c, 0x2d, 0xd0, 0x8d, 0x7f, 0x1d, 0x00, 0x00,
+};
+const WebAsset ASSET_DIAG_HTML = { "text/html", ASSET_DIAG_HTML_GZ, sizeof(ASSET_DIAG_HTML_GZ), "\"9607f2b1783e7d8a\"" };
+
+// fileman.html
+static const uint8_t ASSET_FILEMAN_HTML_GZ[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x8d, 0x58, 0xfb, 0x73, 0xd4, 0x38,
+    0x12, 0xfe, 0x9d, 0xbf, 0x42, 0x4c, 0x51, 0xb1, 0xa7, 0x32, 0xd8, 0x01, 0x36, 0xbb, 0x14, 0xf3,
+    0x48, 0x41, 0x02, 0xbb, 0xec, 0x85, 0x47, 0x01, 0xbb, 0x55, 0x57, 0x1c, 0x75, 0xa5, 0xb1, 0x35,
+    0x33, 0x22, 0xb2, 0x65, 0x24, 0x4d, 0xb2, 0xb3, 0x4b, 0xfe, 0xf7, 0xfb, 0x5a, 0xf2, 0x73, 0x12,
+    0xe0, 0xa8, 0x0a, 0xb6, 0x5b, 0xdd, 0xad, 0x56, 0xf7, 0xd7, 0x0f, 0xcd, 0xec, 0xee, 0xd9, 0x9b,
+    0xd3, 0x0f, 0xff, 0x7e, 0xfb, 0x9c, 0x6d, 0x5c, 0xa1, 0x16, 0x77, 0x66, 0xcd, 0x43, 0xf0, 0x7c,
+    0x71, 0x87, 0xb1, 0x99, 0x93, 0x4e, 0x89, 0xc5, 0xb9, 0xbe, 0x14, 0xcf, 0x76, 0x4e, 0xb0, 0x17,
+    0x52, 0x09, 0xf6, 0x8a, 0x97, 0x7c, 0x2d, 0xcc, 0x2c, 0x0d, 0x8b, 0xc4, 0x56, 0x08, 0xc7, 0x59,
+    0xc9, 0x0b, 0x31, 0x1f, 0x5d, 0x4a, 0x71, 0x55, 0x69, 0xe3, 0x46, 0x2c, 0xd3, 0xa5, 0x13, 0xa5,
+    0x9b, 0x8f, 0xae, 0x64, 0xee, 0x36, 0xf3, 0x47, 0x3f, 0x1f, 0x4d, 0x98, 0x2c, 0xa5, 0x93, 0x5c,
+    0xdd, 0xb7, 0x19, 0x57, 0x62, 0xfe, 0x60, 0xe4, 0xa5, 0x95, 0x2c, 0x2f, 0x98, 0x11, 0x6a, 0x3e,
+    0xb2, 0x6e, 0xa7, 0x84, 0xdd, 0x08, 0x01, 0xf1, 0x8d, 0x11, 0xab, 0xf9, 0x28, 0x55, 0xcb, 0xd4,
+    0x53, 0x93, 0xcc, 0x5a, 0xb0, 0xcf, 0xd2, 0x60, 0xdb, 0x6c, 0xa9, 0xf3, 0x9d, 0x97, 0x96, 0xc5,
+    0x9a, 0x65, 0x8a, 0x5b, 0x3b, 0x1f, 0x29, 0xbd, 0xd6, 0x23, 0x66, 0x4d, 0x06, 0x39, 0x23, 0x6c,
+    0x6a, 0x2b, 0xd0, 0x37, 0xc9, 0xe7, 0x6a, 0x3d, 0x62, 0x5c, 0xc1, 0x92, 0xf6, 0x20, 0xe7, 0xc4,
+    0xe9, 0xc5, 0x37, 0x0f, 0x17, 0xc3, 0x53, 0x81, 0x40, 0xf4, 0xe5, 0xd6, 0x39, 0x5d, 0x36, 0x9a,
+    0x97, 0xae, 0x1c, 0x31, 0x5d, 0x66, 0x4a, 0x66, 0x17, 0xb4, 0x4f, 0xc6, 0x9d, 0xd4, 0x65, 0xe2,
+    0x6d, 0x8c, 0x60, 0x63, 0x34, 0x5a, 0x1c, 0x28, 0x6e, 0xcc, 0x94, 0xfd, 0xa6, 0x0b, 0x31, 0x4b,
+    0x83, 0xf4, 0xed, 0x8a, 0xc8, 0x94, 0xef, 0x2a, 0x4b, 0xd7, 0x5c, 0x29, 0x61, 0x76, 0x50, 0xfa,
+    0x6b, 0x78, 0x1b, 0x28, 0x2c, 0xb5, 0xcd, 0x8c, 0xac, 0xdc, 0x62, 0x56, 0x2d, 0x66, 0xbc, 0xe7,
+    0xa7, 0x15, 0xce, 0x51, 0xf0, 0x32, 0x85, 0xcc, 0x68, 0xf1, 0x56, 0x71, 0x59, 0x32, 0x25, 0xad,
+    0x93, 0xe5, 0x7a, 0x96, 0xf2, 0xc5, 0x2c, 0x05, 0x7b, 0xda, 0x0a, 0x93, 0xa6, 0x5c, 0x5e, 0xd2,
+    0xf3, 0xdb, 0x46, 0xca, 0x7c, 0x3e, 0x72, 0x7c, 0xf9, 0x5f, 0x59, 0xc0, 0x37, 0x70, 0xff, 0x4b,
+    0xff, 0xec, 0x5b, 0xf3, 0x63, 0xd9, 0x42, 0x58, 0x1b, 0xa4, 0x5f, 0xd5, 0x6f, 0x83, 0xd3, 0xa4,
+    0xb5, 0x11, 0x64, 0x4c, 0xa3, 0xc3, 0x8a, 0x8c, 0x3c, 0x32, 0xaa, 0x37, 0x90, 0x65, 0xb5, 0x75,
+    0xcc, 0xed, 0x2a, 0xc0, 0xcb, 0x89, 0xbf, 0x6a, 0xdd, 0x38, 0xad, 0x13, 0x66, 0xc4, 0x10, 0xe3,
+    0x4c, 0x6c, 0xb4, 0xca, 0x85, 0x99, 0x8f, 0x5e, 0x78, 0x22, 0x5b, 0xee, 0x3c, 0x1a, 0x1b, 0x05,
+    0x8a, 0x2f, 0x85, 0x5a, 0xbc, 0x07, 0x2a, 0x9f, 0xcc, 0xd2, 0xf0, 0x11, 0x16, 0xac, 0x50, 0xd8,
+    0xca, 0xab, 0xb3, 0x84, 0xd9, 0x40, 0xc6, 0x82, 0xae, 0xc8, 0x00, 0x76, 0xc9, 0xd5, 0x16, 0x9b,
+    0x06, 0x5d, 0xaf, 0x39, 0x45, 0x36, 0xac, 0x7c, 0x83, 0xf1, 0xbe, 0x93, 0x9e, 0x53, 0x5c, 0x09,
+    0xeb, 0x7e, 0xc0, 0x1b, 0x58, 0xdf, 0xc0, 0xee, 0x1f, 0xb2, 0xde, 0xb7, 0xf2, 0x6f, 0xf0, 0x9e,
+    0x73, 0xb3, 0xfe, 0x31, 0x73, 0xe0, 0x7d, 0x5f, 0x10, 0x72, 0xf6, 0x99, 0x67, 0x69, 0x38, 0x71,
+    0xfd, 0xd5, 0x73, 0xf9, 0x8a, 0x90, 0x12, 0x1c, 0x9b, 0xe9, 0x6d, 0x09, 0x57, 0x74, 0x91, 0x69,
+    0x5f, 0x10, 0x4e, 0x64, 0x4a, 0x23, 0x01, 0xb4, 0xb9, 0xa5, 0x6a, 0x7c, 0xec, 0x7c, 0x5e, 0xce,
+    0x9c, 0xc1, 0xdf, 0xc6, 0xa7, 0x14, 0x0a, 0xc4, 0xc6, 0x7f, 0xbc, 0x87, 0x45, 0xed, 0xc7, 0x53,
+    0x1f, 0xda, 0xf0, 0x99, 0x12, 0x77, 0xea, 0x9a, 0x6a, 0x43, 0x5a, 0x28, 0xad, 0xbd, 0x15, 0x46,
+    0x5f, 0x59, 0x32, 0xc2, 0xb5, 0x89, 0x9e, 0xfa, 0xed, 0x5b, 0xac, 0x10, 0x53, 0xa1, 0x8d, 0x18,
+    0x0d, 0x8f, 0xd0, 0xb3, 0xbb, 0x6a, 0x57, 0xb4, 0xc6, 0xc2, 0x41, 0xa6, 0xab, 0xdd, 0x94, 0x9d,
+    0x71, 0x73, 0xa1, 0x4b, 0xf1, 0xf8, 0x11, 0x25, 0x04, 0xb1, 0x75, 0x09, 0xc1, 0xd8, 0x6a, 0x5b,
+    0x7a, 0xfb, 0xd8, 0xbd, 0x58, 0xe6, 0x63, 0xf6, 0x0f, 0xca, 0x92, 0xdb, 0x9a, 0x92, 0xe5, 0x3a,
+    0xdb, 0x16, 0x28, 0x66, 0xc9, 0x5a, 0xb8, 0xe7, 0xc8, 0x32, 0xbc, 0x3e, 0xdb, 0xbd, 0xcc, 0x89,
+    0x69, 0xca, 0xae, 0x87, 0xa2, 0x9b, 0x2d, 0x92, 0x30, 0x5e, 0x42, 0xba, 0x0e, 0x90, 0x5c, 0xb1,
+    0x78, 0xc9, 0x16, 0xec, 0xc1, 0xd1, 0x4f, 0x8f, 0x8f, 0x7f, 0xf9, 0x79, 0xdc, 0x28, 0x05, 0x31,
+    0x6d, 0x89, 0x89, 0xd3, 0x2f, 0xe4, 0x5f, 0x22, 0x8f, 0x1f, 0x8c, 0xd9, 0x21, 0x8b, 0xd8, 0xab,
+    0x67, 0xd1, 0xf4, 0x86, 0xfc, 0xc3, 0x9f, 0xf6, 0x85, 0x41, 0xd9, 0x97, 0xfc, 0x57, 0x27, 0x59,
+    0xf3, 0x2e, 0x3d, 0xbd, 0x21, 0x07, 0x73, 0x2f, 0xb9, 0x61, 0x6f, 0x9f, 0xfe, 0xfa, 0x9c, 0xcd,
+    0xa1, 0xe5, 0x68, 0xda, 0xd2, 0xa8, 0x1b, 0xbc, 0x07, 0xf1, 0x1f, 0x16, 0x92, 0xfe, 0x09, 0xfb,
+    0x18, 0xf9, 0xb7, 0x68, 0xc2, 0xa2, 0x34, 0xd0, 0x52, 0x7a, 0x0f, 0xc4, 0x4f, 0x13, 0xd6, 0x24,
+    0x38, 0x71, 0x52, 0x7a, 0x7a, 0xc6, 0x86, 0xe8, 0x59, 0x09, 0x2a, 0xd1, 0x27, 0x76, 0xdd, 0xed,
+    0x92, 0x4b, 0x83, 0x3d, 0x82, 0x0e, 0x0b, 0x16, 0xbd, 0x5a, 0x59, 0xe1, 0x40, 0x42, 0x8f, 0xc8,
+    0x11, 0x1d, 0xbc, 0xad, 0xb8, 0xb2, 0x62, 0xc2, 0x96, 0x5b, 0xbb, 0xeb, 0xbe, 0xd6, 0xa2, 0x24,
+    0xa6, 0xe9, 0x1d, 0xaf, 0x29, 0x4d, 0xd9, 0xb3, 0x2d, 0x32, 0x9e, 0xb9, 0x8d, 0xd1, 0xdb, 0xf5,
+    0x86, 0x9d, 0xbd, 0x79, 0xc5, 0x2a, 0xa3, 0x2b, 0x61, 0x9c, 0x14, 0x76, 0xc2, 0x4a, 0x71, 0x89,
+    0x6a, 0x50, 0x20, 0xe2, 0xdb, 0xea, 0x09, 0x0b, 0x2d, 0x8a, 0x49, 0x8b, 0xe2, 0xab, 0x76, 0xcc,
+    0xaf, 0x91, 0xc1, 0x8d, 0x2e, 0x6d, 0x18, 0x2f, 0x99, 0x28, 0x33, 0x9d, 0x8b, 0x9c, 0xfd, 0xf1,
+    0xee, 0x7c, 0xc2, 0xae, 0x36, 0xdc, 0x79, 0xbe, 0x2f, 0x5b, 0xed, 0x84, 0x25, 0x96, 0xa5, 0xe1,
+    0xd9, 0x85, 0x70, 0x96, 0x49, 0xc7, 0xa8, 0xec, 0xd8, 0x61, 0xf4, 0x85, 0x8a, 0x1d, 0x5f, 0x4f,
+    0x00, 0x3d, 0xec, 0x4f, 0xda, 0x3b, 0x1c, 0xd0, 0xc1, 0xe9, 0x64, 0x2d, 0x98, 0x32, 0x23, 0xa0,
+    0xbe, 0xc6, 0x13, 0x89, 0x8d, 0xfb, 0x21, 0x87, 0x86, 0x31, 0x43, 0xdf, 0x23, 0x0c, 0x53, 0xed,
+    0x81, 0x24, 0x48, 0x7d, 0x8e, 0xa0, 0x5e, 0x24, 0xf4, 0x3c, 0x0d, 0xdd, 0x16, 0x4c, 0xf4, 0xb5,
+    0x07, 0x00, 0xd1, 0x8f, 0x7c, 0x6b, 0x2a, 0xf5, 0xdd, 0xd8, 0xdb, 0x49, 0x3d, 0xa4, 0xb5, 0xd6,
+    0xdb, 0xc9, 0xa1, 0x08, 0x47, 0x89, 0x78, 0xd4, 0x3f, 0xca, 0x94, 0x71, 0xdf, 0xa6, 0xb0, 0x48,
+    0x8f, 0x69, 0xa3, 0x9f, 0xdf, 0x48, 0x02, 0x9e, 0xe7, 0x71, 0x05, 0x51, 0xd2, 0x57, 0x25, 0xbc,
+    0xaa, 0x44, 0x99, 0x9f, 0x6e, 0xa4, 0xca, 0xe3, 0x0c, 0x5a, 0x86, 0x94, 0x3d, 0x7f, 0x7c, 0xc0,
+    0x4e, 0xaf, 0x11, 0x82, 0x38, 0x62, 0xd1, 0xd8, 0xa7, 0xd7, 0x50, 0x35, 0x2a, 0x43, 0x2c, 0xf7,
+    0xdc, 0x4a, 0xe7, 0xf6, 0xc8, 0xfd, 0x08, 0x64, 0x01, 0x93, 0x84, 0x92, 0x10, 0xc8, 0x3f, 0xde,
+    0xbd, 0x3c, 0xd5, 0x45, 0x05, 0x4c, 0xc1, 0xc5, 0xd2, 0x7d, 0x3c, 0xfa, 0xd4, 0x3a, 0x99, 0x04,
+    0x69, 0x5c, 0x21, 0x24, 0xf6, 0xfb, 0x27, 0xd1, 0x4e, 0x7c, 0xbb, 0x89, 0x90, 0x38, 0x24, 0x42,
+    0xf9, 0x73, 0x40, 0xcb, 0x9e, 0x52, 0xf6, 0x15, 0x38, 0x53, 0x7b, 0xca, 0x99, 0x68, 0x3c, 0x09,
+    0x08, 0xab, 0x09, 0x39, 0x11, 0xa8, 0x1c, 0x77, 0x04, 0x24, 0x03, 0xfe, 0x42, 0x85, 0x80, 0x31,
+    0x0f, 0x3e, 0x8d, 0xc1, 0xc2, 0x33, 0xd7, 0x13, 0xe9, 0x2b, 0xa7, 0x28, 0xf8, 0x28, 0x91, 0x14,
+    0x99, 0x35, 0x00, 0x88, 0x4f, 0xa2, 0x2e, 0x8b, 0xd8, 0xc1, 0x01, 0x4b, 0xff, 0x93, 0xc4, 0x9f,
+    0x2b, 0x71, 0xb2, 0xfe, 0xba, 0x96, 0xab, 0xf1, 0xbd, 0x54, 0x02, 0x1b, 0xb6, 0x39, 0x77, 0xe7,
+    0x32, 0x0f, 0xf7, 0x0f, 0x30, 0x63, 0x59, 0x72, 0xa9, 0x2c, 0xe3, 0x46, 0x20, 0x4b, 0x72, 0x81,
+    0xc4, 0x60, 0x39, 0xf9, 0x20, 0x47, 0xa4, 0xd9, 0xf1, 0xd1, 0x23, 0x24, 0x37, 0x2f, 0x2d, 0x1b,
+    0x39, 0xb3, 0x63, 0x7c, 0x4d, 0x13, 0x85, 0xdd, 0xa0, 0x51, 0xaa, 0xdd, 0xa8, 0xd5, 0x44, 0x76,
+    0xca, 0xa2, 0x3e, 0x00, 0x86, 0x31, 0x3a, 0xa3, 0x23, 0xd5, 0x74, 0x7a, 0x67, 0x90, 0x87, 0x21,
+    0xad, 0x31, 0x96, 0x35, 0x8e, 0xf6, 0xcb, 0xa9, 0x77, 0x25, 0x79, 0xf6, 0xe4, 0xd2, 0xbb, 0xd5,
+    0xfb, 0x83, 0xbe, 0xef, 0xd7, 0x5f, 0x0f, 0x3f, 0x4d, 0xdb, 0x5d, 0x64, 0x91, 0x28, 0xcd, 0x73,
+    0xcc, 0x32, 0xa4, 0x44, 0xf1, 0xbf, 0x77, 0xd1, 0x60, 0x11, 0xf1, 0x35, 0x46, 0x53, 0x2c, 0x1a,
+    0x9c, 0xc4, 0xfd, 0xe3, 0x06, 0x87, 0x1d, 0x1e, 0x06, 0x7b, 0x66, 0xa8, 0x79, 0xc7, 0x63, 0x86,
+    0x8a, 0xf3, 0x01, 0x4d, 0x58, 0x6f, 0x5d, 0xdc, 0x17, 0x22, 0x75, 0x46, 0x14, 0x18, 0x15, 0x9f,
+    0x3a, 0xf0, 0x63, 0x56, 0x01, 0x14, 0x61, 0x3d, 0x42, 0x43, 0x4b, 0xe1, 0x1c, 0xf8, 0x1f, 0xc8,
+    0x9c, 0xb0, 0xc7, 0x47, 0x47, 0xe3, 0xce, 0x90, 0xeb, 0x81, 0x4d, 0x1d, 0x67, 0x4b, 0xa5, 0xb4,
+    0xe0, 0x18, 0x83, 0x8b, 0x56, 0xe8, 0xba, 0x7e, 0xf2, 0xff, 0x2b, 0x25, 0xea, 0x40, 0x36, 0xc2,
+    0x84, 0xb6, 0x81, 0x1c, 0x1f, 0xd7, 0xa5, 0xb1, 0xde, 0x2a, 0x73, 0x93, 0x1a, 0x40, 0x98, 0xcb,
+    0x6a, 0x0c, 0x21, 0x3e, 0x7f, 0xe2, 0x11, 0x8d, 0x6f, 0x05, 0x53, 0x53, 0xb8, 0xa3, 0xf1, 0x2d,
+    0x1a, 0x68, 0xb2, 0xf3, 0xe5, 0xfd, 0xd6, 0x6c, 0xf9, 0x6c, 0x75, 0xd9, 0xcb, 0x12, 0xf0, 0xfd,
+    0xfe, 0xfe, 0xcd, 0xeb, 0xde, 0x3e, 0xbe, 0xf2, 0xab, 0x16, 0xd3, 0xc1, 0xa4, 0x3a, 0xea, 0xc4,
+    0x7e, 0xa6, 0xaf, 0x4a, 0x8a, 0x72, 0x97, 0x04, 0xb9, 0x4a, 0xf2, 0x9a, 0x48, 0x71, 0x6f, 0x63,
+    0xde, 0x9a, 0x96, 0xab, 0xa1, 0x76, 0xa1, 0x6a, 0x24, 0x86, 0x11, 0x93, 0x8c, 0x25, 0xbb, 0x41,
+    0x0f, 0xbb, 0x45, 0x67, 0x18, 0x80, 0x9c, 0xe8, 0xed, 0x20, 0x54, 0x52, 0xcf, 0xe2, 0xdf, 0x02,
+    0x0f, 0xb9, 0xe7, 0x2e, 0x6e, 0x33, 0x2b, 0x69, 0x8a, 0xb8, 0x56, 0x80, 0x96, 0x83, 0x3e, 0x12,
+    0xea, 0xc3, 0x43, 0x8f, 0xda, 0x13, 0x1c, 0xb4, 0xae, 0x87, 0x5d, 0xbc, 0x57, 0xc2, 0x65, 0x9b,
+    0x78, 0xe0, 0xaf, 0xdc, 0xcb, 0x7f, 0xb7, 0xbe, 0xa0, 0xa5, 0x6f, 0x44, 0xd9, 0x81, 0xd2, 0x78,
+    0x54, 0xc2, 0x0a, 0x93, 0xe8, 0x8b, 0x31, 0x92, 0xaa, 0xc6, 0x67, 0x4c, 0xd5, 0xb1, 0x43, 0x52,
+    0xeb, 0x9c, 0xcc, 0x0d, 0xc1, 0x24, 0x3a, 0x27, 0x41, 0xb6, 0xbf, 0x44, 0x00, 0x82, 0x92, 0x3d,
+    0x2a, 0xd5, 0xac, 0x9b, 0x54, 0xa8, 0x1d, 0xef, 0xf5, 0x15, 0x67, 0x9a, 0xc6, 0xb2, 0xd7, 0x59,
+    0x10, 0xaf, 0x78, 0x6f, 0x00, 0xa2, 0x3e, 0xfe, 0xf5, 0xab, 0xef, 0xee, 0xfb, 0x7e, 0xaa, 0x7b,
+    0xbc, 0x33, 0x5b, 0xd1, 0x0f, 0x26, 0xa5, 0x3a, 0x1a, 0x7e, 0x9f, 0xf4, 0xc5, 0x97, 0x10, 0x5e,
+    0x49, 0xef, 0x4e, 0x7b, 0x02, 0xd4, 0x7a, 0x97, 0x11, 0x7a, 0xc9, 0x87, 0x61, 0x8e, 0xf0, 0xa4,
+    0x7a, 0xa4, 0x20, 0xaa, 0x92, 0x85, 0x0c, 0x44, 0x3f, 0xf1, 0x1c, 0xf6, 0xca, 0x02, 0xfd, 0x8b,
+    0x0e, 0x68, 0xf8, 0xf7, 0xeb, 0xf7, 0x90, 0xe9, 0x78, 0x8f, 0xc6, 0x89, 0x9f, 0xa6, 0xbd, 0xf4,
+    0x17, 0xbf, 0x72, 0x4b, 0x37, 0x01, 0x73, 0xb8, 0x84, 0x34, 0xec, 0xad, 0x7b, 0x42, 0xd8, 0xbf,
+    0xdc, 0x16, 0xc7, 0x01, 0xaa, 0x4c, 0x62, 0x1d, 0x77, 0x5b, 0x4b, 0x99, 0x87, 0x6a, 0x4b, 0x61,
+    0xfe, 0x56, 0x51, 0xea, 0xcf, 0x41, 0xd3, 0xda, 0xc1, 0xbe, 0x02, 0x1d, 0x53, 0x05, 0x6a, 0x02,
+    0x52, 0x6e, 0x95, 0x9a, 0xb6, 0x35, 0xa5, 0x8d, 0x93, 0x49, 0x28, 0x37, 0xe3, 0x0e, 0x2a, 0xfb,
+    0x96, 0xe5, 0x37, 0xf0, 0x9e, 0x53, 0xb0, 0xd6, 0xec, 0xae, 0x0f, 0xc1, 0x4d, 0x60, 0x0f, 0xcc,
+    0x19, 0xf4, 0x82, 0x95, 0xe1, 0xeb, 0x9b, 0x43, 0xce, 0x59, 0xfd, 0xf9, 0x02, 0xab, 0x7e, 0xda,
+    0xe9, 0x55, 0xcd, 0x3c, 0x91, 0x4e, 0x14, 0x36, 0x59, 0x69, 0xf3, 0x9c, 0xc3, 0x6f, 0xad, 0x55,
+    0xbe, 0xcb, 0x7b, 0x85, 0x03, 0x20, 0xd6, 0x03, 0xc0, 0x00, 0xfc, 0x8c, 0x42, 0x47, 0x77, 0x06,
+    0xc4, 0xa2, 0xcf, 0x4b, 0xc2, 0x3d, 0xa6, 0x06, 0x14, 0xf3, 0x76, 0x53, 0x25, 0xca, 0xb5, 0xdb,
+    0xf4, 0x8c, 0x09, 0xd3, 0x67, 0xcd, 0xb8, 0x20, 0xc6, 0x82, 0x23, 0x9a, 0x22, 0x1f, 0x6c, 0xe5,
+    0x2f, 0x49, 0xd8, 0x4b, 0x96, 0x68, 0x3c, 0x54, 0x9e, 0x59, 0x8f, 0xd3, 0x8f, 0xdb, 0x7a, 0xe5,
+    0xcb, 0x43, 0x8e, 0xf1, 0xdc, 0x71, 0xe5, 0x49, 0x1e, 0xb3, 0xd1, 0x00, 0x7f, 0x71, 0x9e, 0xd8,
+    0x0b, 0x09, 0x83, 0x73, 0x76, 0xc2, 0xa8, 0x3e, 0x79, 0x91, 0x86, 0x44, 0x42, 0xa5, 0xc6, 0x05,
+    0xb5, 0xcc, 0x05, 0x26, 0x7c, 0x16, 0x03, 0x16, 0xa4, 0xb8, 0x40, 0xfa, 0x9b, 0xdd, 0x38, 0x62,
+    0x4f, 0x50, 0x13, 0x69, 0xea, 0x27, 0x35, 0xd8, 0x45, 0x90, 0x12, 0x16, 0x6f, 0xab, 0x9c, 0xd3,
+    0xb5, 0xbf, 0x61, 0x18, 0x58, 0x4e, 0x77, 0xa6, 0x7d, 0xc3, 0xe9, 0xcc, 0x27, 0xa4, 0xa4, 0x39,
+    0x00, 0xd4, 0x78, 0xd9, 0xd7, 0x3a, 0x18, 0xcd, 0x56, 0x38, 0x6f, 0x9e, 0x60, 0x2f, 0x10, 0xcf,
+    0x43, 0x23, 0x4e, 0x92, 0xa4, 0xdf, 0x83, 0x3d, 0x68, 0x48, 0x11, 0xc6, 0x90, 0x6e, 0x1b, 0xdc,
+    0x97, 0x9e, 0x91, 0x28, 0xf8, 0x4f, 0x95, 0x44, 0xe0, 0xdf, 0xe1, 0xfa, 0x19, 0xd3, 0x9d, 0xa5,
+    0x62, 0x33, 0x76, 0x85, 0x83, 0xe9, 0xab, 0x60, 0xcb, 0x6f, 0x42, 0xae, 0x37, 0x08, 0x78, 0x0d,
+    0xed, 0x0e, 0xa9, 0x19, 0xd9, 0xf4, 0xbd, 0x64, 0xb8, 0xfd, 0x50, 0xd1, 0x0b, 0x8c, 0x36, 0x38,
+    0x8a, 0xd3, 0x5e, 0x25, 0x6c, 0x6d, 0xe1, 0x72, 0x63, 0xa2, 0x14, 0x88, 0x75, 0xaf, 0x5e, 0x01,
+    0xf1, 0x87, 0x87, 0xd3, 0xde, 0xa5, 0x64, 0x3a, 0xb8, 0x94, 0x4c, 0x6f, 0x45, 0x7f, 0x87, 0xbf,
+    0x70, 0x9c, 0x0f, 0xaf, 0xce, 0x07, 0x2d, 0x0b, 0xeb, 0xdd, 0x4f, 0x29, 0xe0, 0xca, 0xa5, 0xa5,
+    0xfb, 0x2c, 0xf5, 0xb5, 0xbd, 0x41, 0x6e, 0x4f, 0xa2, 0xeb, 0xc8, 0xb7, 0xc9, 0xb4, 0xab, 0x8d,
+    0x54, 0xdf, 0x7f, 0xf5, 0x41, 0xfd, 0x9c, 0x8a, 0xa2, 0x52, 0x57, 0xeb, 0x7e, 0xdd, 0xd2, 0x65,
+    0xf8, 0x75, 0x65, 0xd8, 0xfa, 0x30, 0xf2, 0x0b, 0x6e, 0x9a, 0x3a, 0xe4, 0x45, 0xa9, 0x1f, 0xd0,
+    0x93, 0x26, 0x9a, 0xae, 0x44, 0x79, 0xcf, 0x4d, 0xd8, 0xc3, 0x63, 0xaa, 0x41, 0xd7, 0xad, 0xfa,
+    0xba, 0x86, 0xa2, 0xaf, 0x6e, 0x78, 0xb9, 0x26, 0xc7, 0x79, 0xc6, 0x76, 0x7d, 0xe0, 0x88, 0xdb,
+    0xbb, 0xef, 0xde, 0x15, 0x71, 0xda, 0x04, 0xa9, 0xbf, 0xcd, 0x9e, 0x77, 0xbe, 0xaf, 0xa8, 0x73,
+    0xd4, 0x0d, 0x55, 0x25, 0xee, 0x00, 0x2f, 0x71, 0x7d, 0x32, 0xf5, 0x0f, 0x4f, 0x6f, 0x96, 0x56,
+    0x18, 0xdc, 0xfa, 0x3a, 0xd0, 0x89, 0xa6, 0x03, 0x0b, 0x74, 0xeb, 0x44, 0xda, 0x8e, 0x1b, 0x59,
+    0xd6, 0x55, 0x63, 0xd8, 0x10, 0x44, 0xe3, 0x16, 0x93, 0x75, 0x24, 0x9a, 0x2d, 0xfd, 0x0f, 0x19,
+    0xcd, 0x2f, 0x0e, 0xb3, 0x34, 0xfc, 0xb8, 0x31, 0x4b, 0xc3, 0xef, 0xae, 0xff, 0x03, 0xd1, 0x87,
+    0x1a, 0xb4, 0x8f, 0x15, 0x00, 0x00,
+};
+const WebAsset ASSET_FILEMAN_HTML = { "text/html", ASSET_FILEMAN_HTML_GZ, sizeof(ASSET_FILEMAN_HTML_GZ), "\"e14b6f0d665c3e8c\"" };
+
+// gallery.html
+static const uint8_t ASSET_GALLERY_HTML_GZ[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x7d, 0x56, 0xdb, 0x6e, 0xdc, 0x36,
+    0x10, 0x7d, 0xf7, 0x57, 0x4c, 0x84, 0x60, 0xa5, 0x85, 0x13, 0xc9, 0x49, 0x90, 0x22, 0xe8, 0xae,
+    0xd6, 0x88, 0x6f, 0x49, 0x00, 0xb7, 0x09, 0x02, 0xf7, 0xa1, 0x68, 0xf3, 0xc0, 0x15, 0x47, 0x12,
+    0x6d, 0x8a, 0x14, 0x48, 0xae, 0x9d, 0x6d, 0xed, 0x7f, 0xef, 0x90, 0xba, 0xac, 0xd6, 0x75, 0xf2,
+    0xb4, 0xbc, 0xcc, 0x99, 0xcb, 0x99, 0x33, 0xd4, 0x2e, 0x9f, 0x9d, 0x7d, 0x3e, 0xbd, 0xfa, 0xf3,
+    0xcb, 0x39, 0xd4, 0xae, 0x91, 0xab, 0x83, 0xe5, 0xf0, 0x83, 0x8c, 0xaf, 0x0e, 0x00, 0x96, 0x4e,
+    0x38, 0x89, 0xab, 0x4b, 0x7d, 0x8b, 0x27, 0x5b, 0x87, 0xf0, 0x81, 0x49, 0x89, 0x66, 0xbb, 0xcc,
+    0xba, 0x73, 0x6f, 0xd1, 0xa0, 0x63, 0xa0, 0x58, 0x83, 0x79, 0x74, 0x2b, 0xf0, 0xae, 0xd5, 0xc6,
+    0x45, 0x50, 0x68, 0xe5, 0x50, 0xb9, 0x3c, 0xba, 0x13, 0xdc, 0xd5, 0xf9, 0x9b, 0x5f, 0x8e, 0x5e,
+    0x80, 0x50, 0xc2, 0x09, 0x26, 0x5f, 0xda, 0x82, 0x49, 0xcc, 0x5f, 0x45, 0x01, 0x2d, 0x85, 0xba,
+    0x01, 0x83, 0x32, 0x8f, 0xac, 0xdb, 0x4a, 0xb4, 0x35, 0x22, 0xc1, 0x6b, 0x83, 0x65, 0x1e, 0x65,
+    0x72, 0x9d, 0x85, 0xd3, 0xb4, 0xb0, 0x96, 0xcc, 0x97, 0x59, 0x97, 0xd6, 0x72, 0xad, 0xf9, 0x36,
+    0xa0, 0x45, 0x53, 0x41, 0x21, 0x99, 0xb5, 0x79, 0x24, 0x75, 0xa5, 0x23, 0xb0, 0xa6, 0x20, 0x9c,
+    0x41, 0x9b, 0xd9, 0x96, 0xce, 0xeb, 0xf4, 0xba, 0xad, 0x22, 0x60, 0x92, 0x32, 0x19, 0x6b, 0xb8,
+    0xf4, 0x96, 0x01, 0x5e, 0xbf, 0x5e, 0x8d, 0x05, 0xd1, 0xda, 0x1f, 0xad, 0x37, 0xce, 0x69, 0x35,
+    0x38, 0x5d, 0x3b, 0x15, 0x81, 0x56, 0x85, 0x14, 0xc5, 0x8d, 0x0f, 0x51, 0x30, 0x27, 0xb4, 0x4a,
+    0x43, 0x7a, 0x31, 0xa5, 0x17, 0x47, 0xab, 0x99, 0x64, 0xc6, 0x2c, 0xe0, 0xa3, 0x6e, 0x70, 0x99,
+    0x75, 0xe8, 0xa7, 0x1d, 0xf9, 0x2c, 0x7e, 0xea, 0x2c, 0x2b, 0x85, 0xc4, 0x86, 0x29, 0x72, 0x7a,
+    0x41, 0x2b, 0xf8, 0x8d, 0x29, 0x56, 0xa1, 0xd9, 0xf3, 0xca, 0xc5, 0xed, 0xe0, 0xb2, 0xea, 0x32,
+    0x8f, 0x40, 0x70, 0xda, 0x18, 0xc1, 0xa3, 0xd5, 0x32, 0xa3, 0xfb, 0xd1, 0xce, 0x9f, 0x37, 0xda,
+    0x60, 0x34, 0x20, 0x4a, 0x29, 0xac, 0x9b, 0x5a, 0xb5, 0xe3, 0x8d, 0xd6, 0x74, 0x31, 0x2b, 0x74,
+    0xbb, 0x5d, 0xc0, 0x19, 0x33, 0x37, 0x5a, 0xe1, 0xbb, 0x37, 0xcb, 0xac, 0x0d, 0x66, 0xb6, 0x30,
+    0xa2, 0x75, 0x7e, 0x09, 0x50, 0x6e, 0x54, 0xe1, 0xd3, 0x86, 0xe7, 0x89, 0xe0, 0x73, 0xf8, 0x97,
+    0x7a, 0xe7, 0x36, 0x46, 0x01, 0xd7, 0xc5, 0xa6, 0xa1, 0x8e, 0xa7, 0x15, 0xba, 0x73, 0x2a, 0x83,
+    0x96, 0x27, 0xdb, 0x4f, 0xdc, 0x1b, 0x2d, 0xe0, 0x21, 0x40, 0x6f, 0x99, 0x81, 0x2f, 0xef, 0x3f,
+    0x9c, 0x43, 0x0e, 0x5e, 0x0e, 0xba, 0x2c, 0x2d, 0x3a, 0xda, 0xd0, 0x9a, 0x53, 0x3c, 0x5a, 0x95,
+    0x4c, 0x5a, 0x7c, 0x01, 0xeb, 0x8d, 0xdd, 0x0e, 0xbb, 0xc5, 0x41, 0xc0, 0x66, 0x19, 0x5c, 0xd5,
+    0x9b, 0x66, 0xad, 0x98, 0x90, 0x16, 0x98, 0x41, 0x68, 0x18, 0x47, 0x62, 0x13, 0xb8, 0xa7, 0x8c,
+    0x2f, 0x80, 0xc1, 0xdb, 0xa3, 0x37, 0xd0, 0x20, 0x53, 0x16, 0x22, 0x67, 0xb6, 0xc0, 0x2a, 0x26,
+    0x14, 0xd8, 0x9a, 0xf4, 0x28, 0xb7, 0xd1, 0x7e, 0xf2, 0xce, 0xfb, 0x4a, 0x84, 0xa3, 0x02, 0xc2,
+    0x45, 0x97, 0x9c, 0xa2, 0xa0, 0xa8, 0x0a, 0xcd, 0xf1, 0x8f, 0xaf, 0x9f, 0x4e, 0x75, 0xd3, 0x52,
+    0x56, 0xca, 0x91, 0xd9, 0x5f, 0x47, 0xdf, 0xe6, 0x8b, 0x89, 0xe1, 0xc6, 0x48, 0x32, 0x0d, 0x3d,
+    0x0b, 0x9e, 0xb2, 0x18, 0x0e, 0x09, 0x7d, 0x08, 0xf1, 0xf1, 0x6d, 0xee, 0xd7, 0x04, 0x79, 0xf5,
+    0xcd, 0xef, 0x5f, 0xf6, 0xbb, 0xd7, 0xdf, 0xa6, 0x78, 0x46, 0xe8, 0x91, 0xb0, 0xc2, 0x20, 0x73,
+    0xd8, 0x73, 0x96, 0xc4, 0x2c, 0x1e, 0x43, 0xb1, 0xa0, 0x8d, 0x21, 0x52, 0xaf, 0x8e, 0xcc, 0x0f,
+    0xd9, 0xb1, 0xdb, 0xb6, 0x98, 0x8b, 0x86, 0xf4, 0x31, 0xf3, 0xe7, 0x21, 0xa8, 0xda, 0xe1, 0xc2,
+    0x74, 0x12, 0x30, 0xa4, 0x3e, 0x8d, 0xec, 0x07, 0xe6, 0xc7, 0xb1, 0xe9, 0x76, 0x17, 0x9d, 0x36,
+    0xa9, 0xd4, 0x8c, 0x0b, 0xe5, 0x21, 0xb1, 0x64, 0xff, 0x6c, 0xe3, 0xe9, 0x1d, 0xc9, 0xf9, 0xa9,
+    0x08, 0xce, 0x08, 0xb4, 0xbe, 0xab, 0x53, 0x5b, 0x22, 0xd2, 0x18, 0x6d, 0x7c, 0x53, 0xfb, 0x16,
+    0x24, 0x3b, 0xea, 0xc9, 0xa4, 0x84, 0xe4, 0xf0, 0xb0, 0x43, 0xae, 0xe0, 0xd5, 0xdb, 0x79, 0xaf,
+    0xaa, 0xc5, 0x68, 0x41, 0x4a, 0xb9, 0x12, 0x0d, 0xea, 0x8d, 0x4b, 0xa6, 0x1e, 0x82, 0x73, 0x83,
+    0x0d, 0x8d, 0xf6, 0x7b, 0x47, 0x78, 0x9a, 0x14, 0x4c, 0x62, 0x7a, 0x04, 0xa8, 0x8c, 0x70, 0x47,
+    0x4b, 0x0a, 0x4a, 0xfd, 0x22, 0x11, 0xbe, 0x80, 0x77, 0x47, 0x47, 0x63, 0x79, 0x0f, 0xd3, 0xfc,
+    0x76, 0x66, 0x23, 0x85, 0xac, 0x6d, 0x51, 0xf1, 0xd3, 0x5a, 0x48, 0x12, 0x71, 0x53, 0x8d, 0xb8,
+    0x5e, 0xef, 0xac, 0xdb, 0x3f, 0x1c, 0xec, 0x0b, 0xcb, 0x13, 0x36, 0x29, 0xcd, 0x17, 0x16, 0xd4,
+    0x7c, 0x7f, 0x1f, 0x34, 0xfe, 0xb8, 0xb0, 0x5e, 0xe9, 0xce, 0x6c, 0x70, 0x38, 0x2a, 0xd1, 0x15,
+    0x75, 0x12, 0x67, 0xac, 0x15, 0xa1, 0xe5, 0xf6, 0x98, 0x0b, 0xd3, 0xb5, 0xda, 0xce, 0x2c, 0x89,
+    0x39, 0x7f, 0xe9, 0x88, 0x89, 0x59, 0x37, 0x3e, 0xa1, 0xf1, 0xfd, 0x24, 0x91, 0xdc, 0x66, 0x52,
+    0x34, 0xa2, 0x3b, 0xf4, 0x93, 0x36, 0x4f, 0x5d, 0x8d, 0x6a, 0xc7, 0x98, 0x79, 0x4c, 0xba, 0x49,
+    0xad, 0x63, 0x6e, 0x43, 0xfd, 0xca, 0xfd, 0xf8, 0x78, 0x46, 0x7f, 0xc4, 0xf4, 0xde, 0x50, 0xf6,
+    0x75, 0x06, 0x52, 0xdf, 0x7a, 0x52, 0x07, 0x5a, 0xd4, 0x46, 0xca, 0x61, 0xde, 0x27, 0x6c, 0x99,
+    0xf4, 0xda, 0x7a, 0x3f, 0x23, 0xf9, 0x8f, 0x33, 0xe3, 0x8f, 0x33, 0x7b, 0xc6, 0xff, 0x2f, 0x82,
+    0xfd, 0x77, 0x61, 0x38, 0xf5, 0xa2, 0x2b, 0x0d, 0x7b, 0x42, 0xd7, 0x67, 0xfd, 0xf6, 0x82, 0x6e,
+    0x83, 0xc0, 0xe7, 0x3b, 0x14, 0x4f, 0x85, 0xc3, 0xc6, 0xa6, 0xa5, 0x36, 0xe7, 0x8c, 0x08, 0x1f,
+    0x33, 0x99, 0x3e, 0x0a, 0x43, 0x32, 0xd9, 0xdf, 0x69, 0x72, 0xdd, 0xe2, 0x71, 0x75, 0x5f, 0x89,
+    0x72, 0xfe, 0x3c, 0x13, 0xa9, 0x43, 0x3b, 0x3c, 0x0c, 0xf3, 0x10, 0x7d, 0x4f, 0x2f, 0xe3, 0xf3,
+    0x32, 0x09, 0xf8, 0x30, 0x59, 0x3f, 0x4f, 0x62, 0xff, 0x60, 0xc7, 0xf3, 0x3d, 0x94, 0x77, 0x33,
+    0x31, 0x1a, 0xba, 0x9a, 0x8f, 0xb9, 0x4a, 0x54, 0x95, 0xab, 0x27, 0x35, 0x74, 0xaf, 0x66, 0x6f,
+    0xb8, 0xf2, 0x86, 0x0d, 0x23, 0xf5, 0x20, 0xdf, 0x0b, 0xe5, 0xbf, 0x01, 0x14, 0x4a, 0x28, 0x1a,
+    0xc2, 0x2b, 0xfc, 0xee, 0x02, 0x51, 0x84, 0x3c, 0x86, 0x84, 0xa7, 0x4e, 0x3b, 0x26, 0x69, 0x19,
+    0xc7, 0xf0, 0x2b, 0xc4, 0xbf, 0x6b, 0xe8, 0x94, 0x06, 0xa5, 0xde, 0x28, 0x9e, 0xc6, 0x73, 0x7f,
+    0x7a, 0xd9, 0xbd, 0x02, 0x69, 0x9a, 0xc6, 0x8b, 0x47, 0x4d, 0xf2, 0x7e, 0x66, 0xb3, 0x49, 0x14,
+    0x7a, 0xfe, 0x4f, 0x3c, 0x94, 0xec, 0x4f, 0xa5, 0x20, 0xd2, 0xbf, 0x62, 0x41, 0xc4, 0x53, 0x9c,
+    0x16, 0x96, 0x70, 0x27, 0x14, 0xd7, 0x77, 0x5d, 0x2a, 0x1f, 0x51, 0x54, 0x35, 0x91, 0xdd, 0x4b,
+    0x69, 0xa7, 0x8c, 0xc2, 0xd7, 0xf0, 0x33, 0xf1, 0x3d, 0x5d, 0x53, 0x7c, 0x41, 0xdf, 0x06, 0xe4,
+    0xe0, 0x74, 0x70, 0x49, 0xb9, 0x8e, 0x9c, 0xf7, 0x53, 0xaa, 0xf0, 0x0e, 0x3e, 0xd1, 0xff, 0x12,
+    0x63, 0x31, 0xb8, 0xfe, 0xbc, 0xb6, 0x68, 0x6e, 0xd1, 0xec, 0x62, 0x61, 0x78, 0x53, 0xa8, 0x32,
+    0xa4, 0xce, 0xa6, 0xc2, 0xee, 0xac, 0x55, 0x35, 0xdf, 0x89, 0x7e, 0x9e, 0xea, 0x0e, 0x9a, 0x8c,
+    0xa9, 0xf4, 0x91, 0x76, 0xc5, 0x2c, 0xb3, 0xe1, 0xb3, 0x49, 0x1f, 0xf0, 0xf0, 0x7f, 0x85, 0xfe,
+    0x63, 0x84, 0x3f, 0x57, 0xff, 0x01, 0xe2, 0xda, 0x5d, 0x8e, 0x74, 0x09, 0x00, 0x00,
+};
+const WebAsset ASSET_GALLERY_HTML = { "text/html", ASSET_GALLERY_HTML_GZ, sizeof(ASSET_GALLERY_HTML_GZ), "\"12f70c38e935337a\"" };
+
+// landing.html
+static const uint8_t ASSET_LANDING_HTML_GZ[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xad, 0x92, 0x4d, 0x4f, 0xc3, 0x30,
+    0x0c, 0x86, 0xef, 0xfc, 0x0a, 0x2f, 0x07, 0x76, 0x81, 0x15, 0x86, 0x84, 0x90, 0x68, 0x7b, 0x60,
+    0xe3, 0xe3, 0xb0, 0x09, 0x0e, 0x48, 0x88, 0x63, 0x9a, 0x7a, 0x6d, 0x98, 0x1b, 0x57, 0x89, 0xb7,
+    0xa9, 0xff, 0x9e, 0xb4, 0xd5, 0x40, 0x5c, 0x81, 0x53, 0x2c, 0xdb, 0xef, 0xe3, 0x57, 0xb1, 0xd3,
+    0xc9, 0xf2, 0x79, 0xf1, 0xfa, 0xfe, 0x72, 0x0f, 0xb5, 0x34, 0x94, 0x9f, 0xa4, 0xc7, 0x07, 0x75,
+    0x99, 0x9f, 0x00, 0xa4, 0x62, 0x85, 0x30, 0x5f, 0xf1, 0x1e, 0xef, 0x3a, 0x41, 0x78, 0xda, 0x15,
+    0x69, 0x32, 0xe6, 0xfa, 0x6a, 0x83, 0xa2, 0xc1, 0xe9, 0x06, 0x33, 0xb5, 0xb7, 0x78, 0x68, 0xd9,
+    0x8b, 0x02, 0xc3, 0x4e, 0xd0, 0x49, 0xa6, 0x0e, 0xb6, 0x94, 0x3a, 0xbb, 0xba, 0xbe, 0x38, 0x03,
+    0xeb, 0xac, 0x58, 0x4d, 0xe7, 0xc1, 0x68, 0xc2, 0xec, 0x52, 0x0d, 0x6a, 0xb2, 0x6e, 0x0b, 0x1e,
+    0x29, 0x53, 0x41, 0x3a, 0xc2, 0x50, 0x23, 0x46, 0x79, 0xed, 0x71, 0x93, 0xa9, 0x84, 0x8a, 0x64,
+    0xc8, 0xce, 0x4c, 0x08, 0xb1, 0x3d, 0x4d, 0x46, 0x4b, 0x69, 0xc1, 0x65, 0x37, 0xa8, 0x6d, 0x53,
+    0x81, 0x21, 0x1d, 0x42, 0xa6, 0x88, 0x2b, 0x56, 0x10, 0xbc, 0x89, 0x3a, 0x8f, 0x21, 0x09, 0x6d,
+    0xcc, 0xd7, 0xb3, 0x8f, 0xb6, 0x52, 0xa0, 0x29, 0x3a, 0xf9, 0xf2, 0xbf, 0xea, 0x3b, 0x07, 0x79,
+    0x3d, 0xcf, 0xdf, 0x90, 0x0c, 0x37, 0x08, 0xc2, 0x70, 0x6c, 0x98, 0xc4, 0x39, 0xf3, 0xa1, 0x5e,
+    0xec, 0x44, 0xd8, 0x1d, 0x27, 0x14, 0xe2, 0xa0, 0xb0, 0x11, 0xc7, 0xce, 0x90, 0x35, 0xdb, 0x7e,
+    0xa6, 0xd1, 0x62, 0xd9, 0xcd, 0x06, 0xbf, 0xd3, 0xde, 0xaf, 0x21, 0xde, 0x95, 0x53, 0xf5, 0xfd,
+    0x5b, 0x6b, 0x0c, 0x01, 0x5d, 0x85, 0x3e, 0x4d, 0x46, 0xdc, 0x6f, 0xc9, 0x95, 0x26, 0x42, 0xdf,
+    0x45, 0xf6, 0xe3, 0x18, 0xfd, 0x15, 0xb8, 0xb1, 0x84, 0x8d, 0x76, 0x11, 0xf8, 0x10, 0x23, 0x58,
+    0x6b, 0xa7, 0xff, 0xc1, 0x66, 0xdc, 0xfc, 0xc6, 0x56, 0x11, 0xba, 0x18, 0x82, 0x9d, 0x47, 0x58,
+    0xe2, 0xde, 0x1a, 0xfc, 0x2b, 0xb8, 0xb4, 0xba, 0xc7, 0x2e, 0xe3, 0xe3, 0x38, 0x88, 0x35, 0xe1,
+    0x07, 0xb1, 0x3d, 0xc2, 0x36, 0xcc, 0xa2, 0xf2, 0x53, 0xc3, 0x6d, 0x77, 0x0b, 0x4b, 0xed, 0xb7,
+    0xec, 0xf0, 0xe6, 0x2a, 0x4d, 0xda, 0xfe, 0x80, 0xc6, 0xcb, 0x89, 0x0b, 0x1e, 0x4e, 0xfc, 0x13,
+    0x4e, 0x69, 0xc0, 0x40, 0xfa, 0x02, 0x00, 0x00,
+};
+const WebAsset ASSET_LANDING_HTML = { "text/html", ASSET_LANDING_HTML_GZ, sizeof(ASSET_LANDING_HTML_GZ), "\"d8a9824709c1be74\"" };
+
+// portal.html
+static const uint8_t ASSET_PORTAL_HTML_GZ[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xbd, 0x58, 0x6d, 0x6f, 0xdb, 0x36,
+    0x10, 0xfe, 0xde, 0x5f, 0xc1, 0x29, 0xd8, 0xe4, 0xa0, 0xb6, 0x6c, 0xab, 0x75, 0x9b, 0xca, 0x2f,
+    0x03, 0x9a, 0xa4, 0x58, 0x86, 0xae, 0x09, 0xe0, 0x00, 0xc3, 0x80, 0x7e, 0xa1, 0x45, 0xda, 0xe6,
+    0x42, 0x93, 0x02, 0x49, 0xdb, 0xf1, 0x0c, 0xff, 0xf7, 0x1d, 0x49, 0xc9, 0x56, 0x64, 0x39, 0x4d,
+    0x0b, 0x6c, 0x42, 0x20, 0x4b, 0xe4, 0xbd, 0x3c, 0x77, 0x7c, 0xee, 0x48, 0x65, 0xf0, 0xd3, 0xd5,
+    0xed, 0xe5, 0xfd, 0x5f, 0x77, 0xd7, 0x68, 0x6e, 0x16, 0x7c, 0xf4, 0x6a, 0x50, 0xfc, 0x50, 0x4c,
+    0x46, 0xaf, 0x10, 0x5c, 0x03, 0xc3, 0x0c, 0xa7, 0xa3, 0x3f, 0xd9, 0x27, 0x86, 0xc6, 0xd4, 0x2c,
+    0xb3, 0x41, 0xdb, 0x8f, 0xf8, 0xd9, 0x05, 0x35, 0x18, 0x09, 0xbc, 0xa0, 0xc3, 0x60, 0xc5, 0xe8,
+    0x3a, 0x93, 0xca, 0x04, 0x28, 0x95, 0xc2, 0x50, 0x61, 0x86, 0xc1, 0x9a, 0x11, 0x33, 0x1f, 0xbe,
+    0x89, 0x3b, 0x4d, 0x26, 0x98, 0x61, 0x98, 0xb7, 0x74, 0x8a, 0x39, 0x1d, 0x76, 0x83, 0x5c, 0x5d,
+    0x9b, 0x4d, 0x61, 0xca, 0x5e, 0x13, 0x49, 0x36, 0x68, 0x3b, 0xc1, 0xe9, 0xc3, 0x4c, 0xc9, 0xa5,
+    0x20, 0xc9, 0x59, 0xb7, 0xdb, 0xed, 0xa7, 0x92, 0x4b, 0x95, 0x9c, 0x5d, 0x5f, 0x5f, 0xf7, 0xa7,
+    0x60, 0xb9, 0x35, 0xc5, 0x0b, 0xc6, 0x37, 0x89, 0xc6, 0x42, 0xb7, 0x34, 0x55, 0x6c, 0xda, 0xdf,
+    0xed, 0x2d, 0x44, 0xd6, 0x37, 0x66, 0x82, 0x2a, 0xb4, 0x5d, 0xe0, 0xc7, 0x96, 0x43, 0x90, 0x00,
+    0x82, 0xec, 0xb1, 0xbf, 0xc0, 0x6a, 0xc6, 0x44, 0x12, 0xbf, 0xcd, 0x1e, 0x11, 0x5e, 0x1a, 0xd9,
+    0x2f, 0x3b, 0x8a, 0xe3, 0xb8, 0x9f, 0x61, 0x42, 0x98, 0x98, 0x25, 0x31, 0x5d, 0xf4, 0x27, 0x52,
+    0x11, 0xaa, 0x5a, 0x0a, 0x13, 0xb6, 0xd4, 0xc9, 0x05, 0xa8, 0x4f, 0xe4, 0x63, 0x4b, 0xcf, 0x31,
+    0x91, 0xeb, 0xa4, 0x83, 0x3a, 0xa8, 0xfb, 0x0e, 0xcc, 0x9c, 0x75, 0x3a, 0x9d, 0x8b, 0x92, 0x7b,
+    0x26, 0xb2, 0xa5, 0x69, 0x6a, 0xca, 0x69, 0x6a, 0x9a, 0x93, 0xa5, 0x31, 0x52, 0xa0, 0xad, 0xc7,
+    0xd0, 0xed, 0x74, 0x7e, 0xf6, 0x36, 0xd8, 0x3f, 0xd6, 0x49, 0xee, 0x00, 0x46, 0x0a, 0x60, 0xd1,
+    0x7b, 0xba, 0x40, 0x9d, 0x3d, 0x8a, 0xa8, 0x07, 0x30, 0x5c, 0xc0, 0xa0, 0x41, 0x93, 0x6e, 0xd4,
+    0x3d, 0x82, 0xd5, 0x73, 0xb0, 0xec, 0x48, 0xd2, 0x05, 0x34, 0x5a, 0x72, 0x46, 0xd0, 0x59, 0xaf,
+    0xd7, 0x2b, 0x67, 0x64, 0x62, 0x44, 0x2b, 0x53, 0x0c, 0x9c, 0x54, 0x72, 0x1b, 0x7f, 0xf8, 0x80,
+    0xe3, 0x34, 0x4f, 0xef, 0x7a, 0xce, 0x0c, 0xad, 0xaa, 0x11, 0x2c, 0x66, 0x36, 0x93, 0x65, 0x2d,
+    0x0c, 0x89, 0x3a, 0xa1, 0xa2, 0x0d, 0x36, 0x4b, 0x6d, 0x13, 0x6f, 0xe3, 0x69, 0x19, 0x99, 0x25,
+    0xdd, 0x27, 0x31, 0x44, 0x1f, 0x6c, 0x4c, 0x07, 0x0d, 0x8e, 0x27, 0x94, 0xa3, 0x2d, 0x61, 0x3a,
+    0xe3, 0x78, 0x93, 0x4c, 0xb8, 0x4c, 0x1f, 0xfa, 0x25, 0x6d, 0x97, 0x82, 0xfc, 0x7d, 0x22, 0x21,
+    0x9b, 0x8b, 0xc4, 0x65, 0xc1, 0x5b, 0x18, 0xb4, 0x73, 0xfa, 0x0c, 0xda, 0x9e, 0xaf, 0x03, 0xcb,
+    0x9f, 0x9c, 0x59, 0x84, 0xad, 0x50, 0xca, 0xb1, 0xd6, 0xc3, 0x60, 0x4f, 0x89, 0xe0, 0xc0, 0x34,
+    0x37, 0xef, 0xd4, 0x73, 0x96, 0xfa, 0xf5, 0x31, 0xf4, 0xd1, 0xb4, 0x30, 0x67, 0x33, 0x91, 0xa4,
+    0xc0, 0x60, 0xaa, 0x2a, 0xde, 0xc1, 0x79, 0xc9, 0x88, 0xa7, 0x70, 0x86, 0x45, 0x61, 0xe9, 0x10,
+    0x69, 0x5c, 0xc4, 0xbd, 0xa6, 0x6c, 0x36, 0x37, 0xb0, 0xda, 0x9c, 0xf4, 0x83, 0xd1, 0x67, 0xb9,
+    0xa2, 0x1f, 0x37, 0x86, 0x16, 0xa5, 0x64, 0x95, 0x4b, 0xa0, 0xda, 0x80, 0xaa, 0xf4, 0x3a, 0x95,
+    0x6a, 0x81, 0x18, 0xb1, 0x08, 0xa7, 0xec, 0x13, 0xbc, 0x54, 0x7d, 0xbb, 0xfc, 0xf9, 0xda, 0xfc,
+    0x42, 0xcd, 0x5a, 0xaa, 0x87, 0x41, 0xdb, 0x8f, 0x55, 0x30, 0x3a, 0x42, 0x3a, 0x53, 0x5a, 0x33,
+    0x72, 0xa5, 0x64, 0x06, 0x34, 0x16, 0x41, 0x81, 0xfb, 0x28, 0xc8, 0x7e, 0xc5, 0x93, 0xb3, 0x22,
+    0x33, 0xc3, 0x80, 0xcf, 0x2b, 0xcc, 0x97, 0xa0, 0x13, 0x8c, 0xee, 0x38, 0xc5, 0x9a, 0xa2, 0xdc,
+    0x38, 0xb4, 0x81, 0x02, 0x82, 0x17, 0xac, 0x60, 0x68, 0x7b, 0xb9, 0xca, 0xa8, 0x2b, 0x18, 0x64,
+    0x36, 0x19, 0x58, 0xb4, 0xc9, 0x0f, 0xf6, 0x20, 0x03, 0x04, 0x9c, 0x48, 0xe9, 0x1c, 0x12, 0x47,
+    0xd5, 0x30, 0x18, 0x8f, 0x6f, 0xae, 0x5e, 0x8e, 0x37, 0xcf, 0xcc, 0x1d, 0xac, 0x3f, 0x40, 0x22,
+    0xf5, 0x59, 0x29, 0xfb, 0xce, 0x72, 0x49, 0xef, 0xdf, 0xbe, 0x55, 0xfc, 0xbb, 0x24, 0x17, 0xf6,
+    0xaa, 0xde, 0xf2, 0x4a, 0xf7, 0xa6, 0xfc, 0x4b, 0x80, 0xa4, 0x48, 0x39, 0x4b, 0x1f, 0x20, 0x1a,
+    0xbc, 0xa2, 0x8d, 0xf3, 0xa0, 0xa0, 0x63, 0xa9, 0x1e, 0x83, 0xd1, 0xa5, 0x14, 0xc2, 0x66, 0xef,
+    0x17, 0x34, 0x06, 0xa9, 0x41, 0xdb, 0x2b, 0x7f, 0x97, 0x79, 0x60, 0xc9, 0x8c, 0x9a, 0x8a, 0x03,
+    0x5f, 0xb9, 0xc1, 0xe8, 0x93, 0x9b, 0x44, 0x16, 0xfd, 0xb1, 0xf1, 0x41, 0xdb, 0x32, 0xac, 0x52,
+    0x14, 0xb9, 0x11, 0x5f, 0xcb, 0xf9, 0x72, 0xf8, 0xe7, 0xd1, 0xd8, 0xfd, 0x26, 0x28, 0x8a, 0xa2,
+    0x12, 0x55, 0xcb, 0x8f, 0x3a, 0x55, 0x2c, 0x2b, 0xad, 0xf1, 0x74, 0x29, 0x52, 0x47, 0x9a, 0x09,
+    0x56, 0xba, 0xa1, 0x60, 0x5d, 0xcf, 0xd1, 0xf6, 0x49, 0x70, 0x0a, 0x0a, 0x41, 0x09, 0x64, 0xa7,
+    0xd0, 0x68, 0x88, 0x5a, 0xbd, 0x1e, 0xfa, 0x15, 0x85, 0x5f, 0x97, 0x71, 0xef, 0x22, 0x76, 0xf7,
+    0xb7, 0xee, 0xfe, 0xce, 0xdd, 0x2f, 0x42, 0x94, 0x1c, 0x44, 0xdf, 0xbd, 0xaf, 0x17, 0x7d, 0x22,
+    0xf4, 0xfe, 0xa2, 0x2a, 0x64, 0xa7, 0xf3, 0x81, 0xb0, 0xbf, 0xc7, 0xb2, 0x7b, 0xb5, 0x7f, 0x6c,
+    0xb7, 0x51, 0x1b, 0xf6, 0x29, 0x81, 0x60, 0x83, 0x59, 0x53, 0xa5, 0xd1, 0x54, 0xc9, 0x05, 0x32,
+    0x73, 0x8a, 0x08, 0x5d, 0xb1, 0x94, 0x86, 0x1a, 0xa5, 0x38, 0x85, 0x57, 0x6c, 0xec, 0x2a, 0xc0,
+    0xaf, 0x20, 0x10, 0xc7, 0x54, 0x51, 0x3d, 0xa7, 0x1a, 0x31, 0x28, 0x34, 0x51, 0x36, 0x66, 0x35,
+    0x0f, 0x1d, 0xb4, 0x09, 0x6d, 0x1a, 0x65, 0x92, 0x73, 0xe8, 0xf1, 0x50, 0x32, 0x2b, 0xe8, 0xaf,
+    0xae, 0xef, 0x69, 0x27, 0x67, 0x37, 0x50, 0xcc, 0x8f, 0xf3, 0x67, 0xf1, 0x34, 0xaa, 0xb9, 0x9b,
+    0x52, 0x93, 0xce, 0x1b, 0xa1, 0x03, 0x1b, 0x9e, 0x47, 0xa0, 0x2f, 0x1a, 0x0a, 0x0d, 0x47, 0x48,
+    0x45, 0x7f, 0x6b, 0x09, 0xf2, 0xf9, 0x18, 0xb1, 0x63, 0xdb, 0xa3, 0x82, 0xe6, 0x40, 0x0c, 0x92,
+    0xb7, 0x02, 0x34, 0x44, 0x44, 0xa6, 0xcb, 0x05, 0x34, 0xbd, 0x08, 0x08, 0x73, 0xcd, 0xa9, 0x7d,
+    0xfc, 0xb8, 0xb9, 0x21, 0x8d, 0xb0, 0xdc, 0x32, 0xc2, 0xf3, 0x7e, 0xad, 0x9d, 0x07, 0x4a, 0x33,
+    0x6b, 0x23, 0x17, 0x8b, 0x5c, 0x93, 0x38, 0x16, 0xdd, 0xcf, 0x33, 0xa0, 0xbd, 0xfa, 0xed, 0xfe,
+    0x8f, 0xcf, 0xa0, 0x14, 0x86, 0xf5, 0x36, 0x09, 0x9d, 0xe2, 0x25, 0x37, 0xb7, 0x99, 0x29, 0xa3,
+    0x4b, 0x15, 0xc5, 0x86, 0xe6, 0x00, 0x1b, 0xa1, 0xef, 0x35, 0x75, 0xb0, 0x0e, 0xea, 0x1e, 0xcd,
+    0x09, 0x4f, 0x25, 0x31, 0xdb, 0x80, 0xac, 0xab, 0x28, 0xef, 0x64, 0x3a, 0xe2, 0x54, 0xcc, 0xcc,
+    0xdc, 0x32, 0xe8, 0x44, 0xb3, 0x0b, 0x8f, 0xec, 0xd9, 0x2b, 0x41, 0x0d, 0x12, 0xd9, 0x55, 0x11,
+    0x76, 0x91, 0x41, 0x7b, 0x9c, 0x3f, 0x43, 0xe5, 0x38, 0xfa, 0x7d, 0x91, 0x85, 0x01, 0x60, 0x97,
+    0x65, 0x45, 0x6d, 0x00, 0x45, 0xb2, 0x70, 0x96, 0x51, 0x41, 0x2e, 0xe7, 0x8c, 0x93, 0xc6, 0x01,
+    0x6e, 0x9d, 0xc6, 0x01, 0x39, 0x54, 0xf6, 0x35, 0x90, 0xb4, 0x21, 0xea, 0xd7, 0xbe, 0xc8, 0xb1,
+    0xfc, 0xc1, 0xe4, 0xda, 0x4b, 0x96, 0x32, 0x2b, 0x22, 0xcb, 0x92, 0xd3, 0x72, 0x79, 0x6a, 0xbd,
+    0x18, 0x7a, 0x8d, 0x42, 0x04, 0x7f, 0xaf, 0x7d, 0x5b, 0x10, 0x91, 0x6f, 0x0c, 0xaf, 0x11, 0x3c,
+    0x4a, 0x08, 0xd5, 0x66, 0xcc, 0xa5, 0x09, 0x7d, 0x5d, 0x5e, 0x5d, 0xbc, 0xb9, 0x82, 0xfb, 0x55,
+    0x37, 0x3e, 0x05, 0xa3, 0x36, 0x4d, 0xb2, 0x36, 0x3f, 0xbb, 0xe7, 0xb2, 0x5c, 0x84, 0x62, 0xa9,
+    0xfc, 0x8c, 0x18, 0x54, 0xfc, 0xdc, 0x36, 0x57, 0x90, 0x2c, 0xaa, 0xf3, 0xa8, 0x30, 0xf7, 0x4a,
+    0xcf, 0x95, 0x14, 0x54, 0x6c, 0xe1, 0xf2, 0x5b, 0x65, 0xb3, 0x7b, 0x3a, 0xb4, 0x3b, 0x8f, 0x52,
+    0x6c, 0x4b, 0x1f, 0x1c, 0xff, 0xa7, 0x95, 0xfd, 0x5d, 0xe5, 0xfa, 0xa3, 0x54, 0x92, 0xdf, 0x28,
+    0xd0, 0x12, 0x7d, 0x5c, 0x1d, 0xa1, 0x29, 0x66, 0x9c, 0x92, 0xf0, 0x85, 0x05, 0x73, 0xcc, 0x84,
+    0x32, 0x0b, 0x9e, 0xb6, 0xfd, 0x1b, 0xff, 0x95, 0xe2, 0xba, 0x6d, 0x13, 0x5a, 0x7a, 0x06, 0x21,
+    0x20, 0xdb, 0xa2, 0x37, 0x28, 0xd6, 0x7b, 0xc1, 0x35, 0x13, 0xe0, 0x05, 0x88, 0xc0, 0x25, 0x86,
+    0xd6, 0xea, 0xa4, 0x0f, 0x16, 0x35, 0x35, 0x37, 0xf6, 0xe4, 0x08, 0x21, 0x35, 0xbc, 0x9d, 0x18,
+    0x3e, 0x12, 0xc0, 0x65, 0x4d, 0x53, 0x77, 0x07, 0x83, 0xca, 0xfa, 0xd9, 0x54, 0xba, 0x22, 0x19,
+    0xbe, 0x8c, 0x3e, 0xfd, 0x23, 0x6d, 0x7b, 0x7a, 0x79, 0x4e, 0xdb, 0xce, 0xd7, 0x6b, 0xef, 0x37,
+    0x14, 0x00, 0x16, 0x36, 0x6b, 0x88, 0x05, 0x9f, 0x7b, 0x73, 0x49, 0xa0, 0x32, 0xef, 0x6e, 0xc7,
+    0xf7, 0x61, 0xf3, 0x68, 0xde, 0x9e, 0xc3, 0x61, 0xc7, 0x4c, 0xd0, 0x36, 0xbc, 0xf4, 0x1f, 0x81,
+    0xad, 0x7b, 0x38, 0xb5, 0x84, 0xa0, 0x01, 0x6b, 0x02, 0xe7, 0x15, 0x6c, 0x03, 0x6f, 0xdb, 0xdd,
+    0x29, 0xdc, 0x1d, 0xab, 0xdb, 0xf3, 0x7b, 0x82, 0x7e, 0x1f, 0xdf, 0x7e, 0x81, 0x6f, 0x09, 0x05,
+    0xfd, 0x92, 0x4d, 0x37, 0x8d, 0xad, 0x8d, 0x36, 0xb1, 0xb7, 0xa6, 0x45, 0x9e, 0xd8, 0xdb, 0xee,
+    0xbc, 0x5a, 0x10, 0xe5, 0xcd, 0xcf, 0xb2, 0x65, 0xbf, 0xf9, 0x99, 0xfa, 0x12, 0x39, 0x9d, 0x5b,
+    0x77, 0xc8, 0x81, 0xfc, 0x38, 0xce, 0xdf, 0x7b, 0xe2, 0x99, 0x17, 0x31, 0x68, 0xbf, 0xb0, 0xc5,
+    0x91, 0xec, 0xc4, 0x7e, 0xed, 0xa7, 0xc3, 0xff, 0x19, 0xf4, 0xf7, 0x34, 0xa4, 0xda, 0x8d, 0xf2,
+    0x25, 0x7c, 0xaa, 0xd1, 0x7d, 0x9a, 0xac, 0xfc, 0x5b, 0x20, 0x3f, 0x27, 0xc2, 0x99, 0xd4, 0x7d,
+    0xb2, 0xc1, 0x17, 0x9c, 0xfb, 0xc7, 0xc3, 0xbf, 0xff, 0xc3, 0xcd, 0x32, 0x90, 0x10, 0x00, 0x00,
+};
+const WebAsset ASSET_PORTAL_HTML = { "text/html", ASSET_PORTAL_HTML_GZ, sizeof(ASSET_PORTAL_HTML_GZ), "\"2491c8feb078dbfe\"" };
+
+// style.css
+static const uint8_t ASSET_STYLE_CSS_GZ[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x85, 0x56, 0xdb, 0xae, 0x9c, 0x3a,
+    0x0c, 0x7d, 0xef, 0x57, 0x44, 0xda, 0xaa, 0x74, 0x2a, 0x6d, 0x50, 0xc8, 0x30, 0x14, 0x32, 0x3a,
+    0x5f, 0x72, 0xd4, 0x87, 0x00, 0x06, 0xd2, 0x66, 0x08, 0x0a, 0x99, 0x5b, 0x8f, 0xfa, 0xef, 0x4d,
+    0x42, 0xb8, 0xb3, 0x5b, 0x8d, 0x84, 0x80, 0x89, 0xed, 0xe5, 0xe5, 0x65, 0x9b, 0x5c, 0x96, 0x2f,
+    0xf4, 0x3f, 0xca, 0x59, 0xf1, 0xa3, 0x56, 0xf2, 0xd6, 0x96, 0xf4, 0x2d, 0xc2, 0xe6, 0x97, 0x5c,
+    0x50, 0x21, 0x85, 0x54, 0xf4, 0xad, 0xaa, 0xaa, 0x0b, 0xaa, 0x64, 0xab, 0x83, 0x8a, 0x5d, 0xb9,
+    0x78, 0xd1, 0x9e, 0xb5, 0x7d, 0xd0, 0x83, 0xe2, 0xe6, 0xbd, 0x86, 0xa7, 0x0e, 0x98, 0xe0, 0x75,
+    0x4b, 0x0b, 0x68, 0x35, 0xa8, 0x0b, 0xba, 0x32, 0x55, 0xf3, 0x96, 0xe2, 0x0b, 0xfa, 0xf5, 0x29,
+    0x14, 0xb2, 0x96, 0xc6, 0xfd, 0x83, 0x97, 0xba, 0xa1, 0x11, 0x49, 0xbb, 0xe7, 0x74, 0xe0, 0x44,
+    0xba, 0x27, 0x62, 0x37, 0x2d, 0x11, 0xc1, 0xfe, 0xee, 0x82, 0x4a, 0xde, 0x77, 0x82, 0xbd, 0x68,
+    0x2e, 0x64, 0xf1, 0xe3, 0x82, 0x72, 0xa9, 0x4a, 0x50, 0x81, 0x62, 0x25, 0xbf, 0xf5, 0x34, 0x4a,
+    0xac, 0x79, 0x2e, 0x9f, 0x41, 0xdf, 0xb0, 0x52, 0x3e, 0x28, 0x46, 0x18, 0x91, 0xd8, 0x18, 0xbf,
+    0x11, 0x42, 0x52, 0x17, 0xb0, 0x87, 0x42, 0x73, 0xd9, 0x6e, 0x53, 0x4a, 0xa3, 0x94, 0x9c, 0xa7,
+    0xd0, 0x84, 0x4c, 0x01, 0xaf, 0xec, 0x19, 0x0c, 0xe8, 0x4e, 0x31, 0xb6, 0xee, 0x3b, 0x56, 0x96,
+    0xbc, 0xad, 0xa9, 0x03, 0xe5, 0x2e, 0x11, 0xf1, 0x77, 0x3b, 0x3c, 0x64, 0x87, 0xc7, 0x1e, 0x8d,
+    0x1c, 0x22, 0x8c, 0x71, 0xb2, 0xe2, 0x47, 0x40, 0xa5, 0x2d, 0xc4, 0x86, 0x18, 0x70, 0x1f, 0xf2,
+    0x16, 0xe4, 0x52, 0x6b, 0x79, 0xa5, 0x38, 0x8c, 0xe1, 0xea, 0x32, 0xca, 0xb5, 0xcd, 0x66, 0x24,
+    0x86, 0xb7, 0x82, 0xb7, 0x10, 0x78, 0x7e, 0x7c, 0x3e, 0xa9, 0x05, 0xb8, 0x04, 0x1f, 0xe1, 0x19,
+    0xf2, 0x82, 0x86, 0xaa, 0x4a, 0xb2, 0x3c, 0x5e, 0x57, 0x76, 0x48, 0x89, 0xb6, 0xb2, 0x85, 0x6d,
+    0x7e, 0xae, 0x5a, 0xae, 0xf2, 0x3d, 0xff, 0x09, 0x34, 0x0a, 0x23, 0x0b, 0xc9, 0xbd, 0x78, 0x00,
+    0xaf, 0x1b, 0x4d, 0x73, 0x29, 0xca, 0x0b, 0x12, 0xa0, 0x4d, 0x06, 0x41, 0xdf, 0xb1, 0xc2, 0x05,
+    0xb7, 0x66, 0xc5, 0x4d, 0xf5, 0x26, 0x46, 0x27, 0xf9, 0x90, 0x9d, 0x56, 0x46, 0x35, 0xdc, 0x96,
+    0x86, 0xce, 0x88, 0x50, 0x48, 0xfa, 0x03, 0x02, 0x53, 0xcf, 0x5f, 0xec, 0xf9, 0x2b, 0xa1, 0x90,
+    0x8a, 0x39, 0xdb, 0x01, 0xe6, 0xc0, 0x0a, 0x35, 0x9c, 0xb0, 0x5c, 0x40, 0x69, 0xe8, 0x91, 0x36,
+    0xb6, 0x7e, 0x19, 0xda, 0xce, 0xeb, 0x94, 0xe3, 0x38, 0x9e, 0xce, 0x37, 0xf2, 0x0e, 0x6a, 0xa3,
+    0x8c, 0x0a, 0x9f, 0x08, 0x4b, 0xc7, 0x23, 0x61, 0xce, 0xeb, 0x05, 0xd9, 0x9e, 0xe5, 0x41, 0x1f,
+    0x64, 0xe0, 0xd3, 0x53, 0x1e, 0xa5, 0x93, 0x84, 0x26, 0xd2, 0xed, 0x2b, 0xbc, 0x13, 0x09, 0xde,
+    0xb2, 0x78, 0xb2, 0x2c, 0x6e, 0x38, 0xfb, 0x40, 0x49, 0x64, 0x66, 0xc2, 0x03, 0x34, 0x58, 0x60,
+    0x6e, 0x28, 0x8c, 0x3f, 0x4f, 0xc2, 0xd1, 0xb2, 0x9b, 0x14, 0xf9, 0x67, 0x00, 0x64, 0x56, 0x56,
+    0xc8, 0x84, 0xde, 0x30, 0xf2, 0x35, 0x81, 0xd5, 0x71, 0x7f, 0xb8, 0x04, 0x31, 0x28, 0x71, 0x79,
+    0x36, 0x35, 0xd8, 0xc8, 0xd0, 0xe9, 0x95, 0xe0, 0xbd, 0x75, 0x35, 0x5b, 0xe2, 0x30, 0x3b, 0x5b,
+    0x63, 0xaf, 0xb6, 0xa2, 0x80, 0x79, 0x38, 0x84, 0xe6, 0x1f, 0xe4, 0x0c, 0x05, 0xcb, 0x41, 0x8c,
+    0x76, 0x2b, 0x59, 0x2d, 0xba, 0xd9, 0x1d, 0x0a, 0x95, 0x7c, 0x98, 0x83, 0xcb, 0x74, 0x5d, 0x6a,
+    0x9b, 0x6a, 0xfd, 0xfa, 0xc4, 0xdb, 0xee, 0xa6, 0xff, 0xd3, 0xaf, 0x0e, 0xfe, 0xb5, 0xfa, 0xf9,
+    0xf6, 0xbe, 0x78, 0xd1, 0xde, 0xae, 0x39, 0xa8, 0x6f, 0x13, 0x85, 0x59, 0x3a, 0x31, 0x48, 0xcf,
+    0x47, 0xf5, 0x4b, 0x66, 0x46, 0xad, 0xb2, 0x51, 0x2f, 0x05, 0x2f, 0xd1, 0x5b, 0x96, 0x65, 0x3b,
+    0x96, 0x46, 0x21, 0x7c, 0x9d, 0x8a, 0xc9, 0x7f, 0xda, 0x67, 0xef, 0xd0, 0xbc, 0xd9, 0xa0, 0x33,
+    0x3d, 0x51, 0xc3, 0x02, 0xcb, 0xa6, 0x9a, 0xae, 0xff, 0xbc, 0x41, 0xd8, 0x5f, 0x99, 0x10, 0xd3,
+    0xd1, 0xd8, 0xff, 0x67, 0xf3, 0x63, 0x0a, 0xd8, 0xec, 0xe3, 0x6c, 0x7d, 0x18, 0x07, 0xcd, 0x40,
+    0x65, 0x72, 0x30, 0xb7, 0x92, 0xc3, 0xbe, 0xf6, 0x24, 0x24, 0x96, 0x04, 0xe4, 0x06, 0x08, 0x3e,
+    0x4a, 0xfc, 0x7c, 0x3e, 0xbb, 0xd2, 0x28, 0xe8, 0x6f, 0x4e, 0x3b, 0xd3, 0x30, 0xc9, 0xe7, 0xe6,
+    0x88, 0x9d, 0x13, 0x6c, 0x3d, 0xec, 0x95, 0x54, 0x71, 0x23, 0xfe, 0x5c, 0x4c, 0xa5, 0xa4, 0x8b,
+    0xf9, 0xef, 0x81, 0x1a, 0x9f, 0x82, 0x75, 0x3d, 0xd0, 0xf1, 0x66, 0x6c, 0xc2, 0x2c, 0xf9, 0xbc,
+    0xf2, 0xa1, 0x9b, 0x77, 0x34, 0x3f, 0xd8, 0x49, 0xb0, 0x47, 0x7c, 0x22, 0x27, 0x12, 0x17, 0x73,
+    0x79, 0x6c, 0x9b, 0xc6, 0x03, 0x7d, 0x0b, 0x3f, 0x1b, 0x65, 0x13, 0xa3, 0x6b, 0xbf, 0x52, 0xa6,
+    0x33, 0x66, 0x4a, 0xea, 0x26, 0x28, 0x1a, 0x2e, 0xca, 0x7f, 0xe0, 0x0e, 0xed, 0x97, 0x83, 0x2d,
+    0x13, 0x15, 0x5b, 0x9b, 0xa3, 0xa9, 0x43, 0x22, 0x12, 0xc5, 0x4e, 0xfe, 0xec, 0x1d, 0x31, 0x7a,
+    0xe7, 0x66, 0x34, 0xba, 0x39, 0xb6, 0x9c, 0xcc, 0xdb, 0xd9, 0x67, 0x2c, 0x41, 0xd9, 0xe9, 0xef,
+    0x22, 0xdc, 0x39, 0x3c, 0xf8, 0xb5, 0x76, 0x2c, 0x8e, 0x2b, 0x2c, 0xc3, 0xf7, 0xc7, 0xb0, 0xd2,
+    0xa6, 0xea, 0xdf, 0x9b, 0xd5, 0x96, 0x58, 0xb1, 0x3c, 0x0e, 0x88, 0xf4, 0x2f, 0x6b, 0x75, 0xd7,
+    0x60, 0x2e, 0xb8, 0x7e, 0xda, 0xea, 0x3f, 0x1a, 0x83, 0xdc, 0x8d, 0x31, 0xa0, 0x9d, 0x82, 0xe0,
+    0xa1, 0x58, 0x77, 0xb0, 0xf6, 0x46, 0x61, 0xcc, 0x95, 0x5e, 0x48, 0x7e, 0xb7, 0xa9, 0xe7, 0x15,
+    0x05, 0x00, 0x8b, 0x01, 0x1b, 0xef, 0xb5, 0x9c, 0x8d, 0x85, 0x94, 0x52, 0xaf, 0x87, 0x03, 0x59,
+    0xcd, 0x9e, 0x62, 0xa9, 0xc4, 0x30, 0xf3, 0x52, 0xac, 0x4d, 0x4f, 0x81, 0x7a, 0x2d, 0x46, 0x7e,
+    0x25, 0xc0, 0x36, 0x87, 0xb9, 0xba, 0x54, 0xe8, 0x90, 0xcf, 0xf7, 0x5b, 0xaf, 0x79, 0xf5, 0x32,
+    0xba, 0x34, 0xdb, 0xac, 0xd5, 0xd3, 0xce, 0xae, 0x99, 0xef, 0xd2, 0x31, 0xbf, 0xe4, 0xe8, 0xc3,
+    0x62, 0xe8, 0xc1, 0x45, 0x38, 0xf6, 0xd1, 0x8e, 0x89, 0xb0, 0x4b, 0xd1, 0x57, 0xcf, 0x3f, 0x1d,
+    0x7d, 0xc8, 0x1c, 0x2c, 0x6a, 0x2b, 0xb3, 0x4a, 0x98, 0xf2, 0x35, 0xbc, 0x2c, 0xa1, 0x5d, 0x05,
+    0x1c, 0x84, 0xb2, 0x5c, 0x1a, 0x53, 0x08, 0xfb, 0x20, 0xf3, 0xef, 0x66, 0xd0, 0x06, 0x15, 0x37,
+    0x99, 0x99, 0x0c, 0x19, 0x77, 0xd6, 0xc6, 0x28, 0xd4, 0x8d, 0x99, 0x97, 0x9b, 0xa9, 0xe3, 0x4d,
+    0x87, 0x87, 0x23, 0x53, 0x03, 0x44, 0xf3, 0x82, 0x09, 0xaf, 0x80, 0xab, 0xc1, 0x23, 0x76, 0x1f,
+    0x17, 0xbe, 0x03, 0x7f, 0x03, 0x7f, 0x4e, 0x26, 0x21, 0x80, 0x0a, 0x00, 0x00,
+};
+const WebAsset ASSET_STYLE_CSS = { "text/css", ASSET_STYLE_CSS_GZ, sizeof(ASSET_STYLE_CSS_GZ), "\"b1ef2b29719f0b90\"" };
@@ -0,0 +1,12 @@
+// Generated by tools/embed_web.py from www/ -- do not edit.
+#pragma once
+#include "web_static.h"
+
+extern const WebAsset ASSET_CLOUD_HTML;  // cloud.html, 5976 -> 2048 bytes
+extern const WebAsset ASSET_CONFIG_HTML;  // config.html, 2348 -> 956 bytes
+extern const WebAsset ASSET_DIAG_HTML;  // diag.html, 7551 -> 2701 bytes
+extern const WebAsset ASSET_FILEMAN_HTML;  // fileman.html, 5519 -> 2198 bytes
+extern const WebAsset ASSET_GALLERY_HTML;  // gallery.html, 2420 -> 1118 bytes
+extern const WebAsset ASSET_LANDING_HTML;  // landing.html, 762 -> 360 bytes
+extern const WebAsset ASSET_PORTAL_HTML;  // portal.html, 4240 -> 1456 bytes
+extern const WebAsset ASSET_STYLE_CSS;  // style.css, 2688 -> 989 bytes
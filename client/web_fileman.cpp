@@ -2,39 +2,78 @@
 #include <Arduino.h>
 #include <SD_MMC.h>
 #include <ESPAsyncWebServer.h>
+#include "display_owner.h"
+#include "file_index.h"
+#include "thumbs.h"
+#include "web_assets.h"
+#include "web_static.h"
+#include "web_arena.h"
+#include <memory>
 
-// Helper: file size as string
-String humanSize(size_t bytes) {
-    if (bytes > 1024 * 1024) return String((float)bytes / 1024.0 / 1024.0, 1) + " MB";
-    if (bytes > 1024) return String((float)bytes / 1024.0, 1) + " KB";
-    return String(bytes) + " B";
+// Helper: file size as text
+static void humanSize(char* out, size_t cap, size_t bytes) {
+    if (bytes > 1024 * 1024) snprintf(out, cap, "%.1f MB", bytes / 1024.0 / 1024.0);
+    else if (bytes > 1024) snprintf(out, cap, "%.1f KB", bytes / 1024.0);
+    else snprintf(out, cap, "%u B", (unsigned)bytes);
 }
 
-void setupFileManagerRoutes(AsyncWebServer& server) {
-    // --- File Manager Main Page ---
-    server.on("/lb/fileman", HTTP_GET, [](AsyncWebServerRequest* request) {
-        String html = R"rawliteral(
+// Escape s into out (NUL-terminated); returns false if it didn't all fit
+static bool htmlEscape(char* out, size_t cap, const char* s) {
+    size_t n = 0;
+    for (; *s && n + 7 < cap; ++s) {
+        switch (*s) {
+            case '&':  memcpy(out + n, "&amp;", 5);  n += 5; break;
+            case '<':  memcpy(out + n, "&lt;", 4);   n += 4; break;
+            case '>':  memcpy(out + n, "&gt;", 4);   n += 4; break;
+            case '"':  memcpy(out + n, "&quot;", 6); n += 6; break;
+            case '\'': memcpy(out + n, "&#39;", 5);  n += 5; break;
+            default:   out[n++] = *s;
+        }
+    }
+    out[n] = 0;
+    return !*s;
+}
+
+// Percent-encode s for a URL path segment or query value; everything but
+// RFC 3986 unreserved characters is encoded, quotes included, so the result
+// is safe inside any attribute. Returns false if it didn't all fit.
+static bool urlEncode(char* out, size_t cap, const char* s) {
+    static const char hex[] = "0123456789ABCDEF";
+    size_t n = 0;
+    for (; *s && n + 4 < cap; ++s) {
+        uint8_t c = *s;
+        if (isalnum(c) || c == '-' || c == '.' || c == '_' || c == '~') {
+            out[n++] = c;
+        } else {
+            out[n++] = '%';
+            out[n++] = hex[c >> 4];
+            out[n++] = hex[c & 15];
+        }
+    }
+    out[n] = 0;
+    return !*s;
+}
+
+#define FILES_PAGE_DEFAULT  100
+#define FILES_PAGE_MAX      200
+
+// --- Streaming directory listing ---
+// The listing is produced lazily inside the chunked-response callback: one
+// directory entry per step, formatted into a fixed row buffer, so memory use
+// is the same for 10 files or 10,000. Names are HTML-escaped for the link
+// text and percent-encoded for the four URLs; a row that still doesn't fit
+// is left out and counted at the end of its section.
+
+#define LIST_NAME_ESC_MAX   384
+#define LIST_ROW_MAX        2048
+
+static const char FILEMAN_HEAD[] = R"rawliteral(
 <!DOCTYPE html>
 <html>
 <head>
   <title>LoveByte File Manager</title>
   <meta name="viewport" content="width=360, initial-scale=1">
-  <style>
-    body { background:#101016; color:#fff; font-family:sans-serif; text-align:center; margin:0; }
-    .logo { width:128px; margin:32px auto 20px auto; display:block; border-radius:16px; box-shadow:0 0 24px #2228; }
-    .btn { display:inline-block; margin:8px 4px; padding:12px 22px; background:#ff69b4; color:#fff; border:none; border-radius:10px; font-size:1.1em; font-weight:bold; cursor:pointer; transition:background .2s; box-shadow:0 2px 10px #0004;}
-    .btn:hover { background:#f032a8; }
-    .delbtn { background:#800020; }
-    .delbtn:hover { background:#f032a8; }
-    .filetbl { margin:20px auto; border-collapse:collapse; width:96%; }
-    .filetbl th, .filetbl td { border:1px solid #32324c; padding:8px 4px; }
-    .filetbl th { background:#202028; }
-    .filetbl tr:nth-child(even) { background:#18181c; }
-    .filetbl tr:hover { background:#212140; }
-    a, a:visited { color:#fff; text-decoration:underline; }
-    .viewimg { max-width:90vw; max-height:60vh; margin:8px auto; border-radius:18px; box-shadow:0 0 24px #2228; display:block; }
-    .viewtxt { white-space:pre-wrap; text-align:left; margin:10px auto; width:90%; background:#181824; color:#eee; padding:14px; border-radius:9px;}
-  </style>
+  <link rel="stylesheet" href="/lb/style.css">
 </head>
 <body>
   <img class="logo" src="/res/splash.jpg" alt="LoveByte Logo">
@@ -42,137 +81,317 @@ void setupFileManagerRoutes(AsyncWebServer& server) {
   <button class="btn" onclick="location.href='/lb'">&larr; Home</button>
 )rawliteral";
 
-        // List images
-        html += "<h3>Images</h3><table class='filetbl'><tr><th>File</th><th>Size</th><th>Action</th></tr>";
-        File idir = SD_MMC.open("/images");
-        if (idir) {
-            while (true) {
-                File f = idir.openNextFile();
-                if (!f) break;
-                if (f.isDirectory()) { f.close(); continue; }
-                String name = String(f.name());
-                if (name.startsWith("/images/")) name = name.substring(8); // Trim prefix
-                html += "<tr><td><a href='/lb/fileman/view?type=image&file=" + name + "'>" + name + "</a></td>";
-                html += "<td>" + humanSize(f.size()) + "</td>";
-                html += "<td>";
-                html += "<a class='btn' href='/lb/fileman/view?type=image&file=" + name + "'>View</a> ";
-                html += "<a class='btn' href='/images/" + name + "' download>Download</a> ";
-                html += "<a class='btn delbtn' href='/lb/fileman/delete?type=image&file=" + name + "' onclick=\"return confirm('Delete this image?');\">Delete</a>";
-                html += "</td></tr>";
-                f.close();
-            }
-            idir.close();
-        } else {
-            html += "<tr><td colspan='3'><i>No images found.</i></td></tr>";
-        }
-        html += "</table>";
-
-        // List messages
-        html += "<h3>Messages</h3><table class='filetbl'><tr><th>File</th><th>Size</th><th>Action</th></tr>";
-        File mdir = SD_MMC.open("/messages");
-        if (mdir) {
-            while (true) {
-                File f = mdir.openNextFile();
-                if (!f) break;
-                if (f.isDirectory()) { f.close(); continue; }
-                String name = String(f.name());
-                if (name.startsWith("/messages/")) name = name.substring(10); // Trim prefix
-                html += "<tr><td><a href='/lb/fileman/view?type=text&file=" + name + "'>" + name + "</a></td>";
-                html += "<td>" + humanSize(f.size()) + "</td>";
-                html += "<td>";
-                html += "<a class='btn' href='/lb/fileman/view?type=text&file=" + name + "'>View</a> ";
-                html += "<a class='btn' href='/messages/" + name + "' download>Download</a> ";
-                html += "<a class='btn delbtn' href='/lb/fileman/delete?type=text&file=" + name + "' onclick=\"return confirm('Delete this file?');\">Delete</a>";
-                html += "</td></tr>";
-                f.close();
-            }
-            mdir.close();
-        } else {
-            html += "<tr><td colspan='3'><i>No message files found.</i></td></tr>";
-        }
-        html += "</table>";
+static const char FILEMAN_FOOT[] =
+    "<p class='foot'>&copy; Darkone83</p></body></html>";
 
-        html += "<p style='margin-top:2em;color:#ccc;font-size:.95em;'>&copy; Darkone83</p>";
-        html += "</body></html>";
-        request->send(200, "text/html", html);
-    });
+struct ListSection {
+    const char* dir;        // SD directory
+    const char* title;
+    const char* type;       // type= parameter for view/delete
+    const char* urlBase;    // download route prefix
+    const char* noun;       // used in the delete confirmation
+    const char* empty;
+};
 
-    // --- Download image file ---
-    server.on("^\\/images\\/(.+)$", HTTP_GET, [](AsyncWebServerRequest* request) {
-        String fname = "/" + request->pathArg(0);
-        File file = SD_MMC.open("/images" + fname);
-        if (!file || file.isDirectory()) {
-            request->send(404, "text/plain", "Image not found");
-            return;
+static const ListSection LIST_SECTIONS[] = {
+    { "/images",   "Images",   "image", "/images/",   "image", "No images found." },
+    { "/messages", "Messages", "text",  "/messages/", "file",  "No message files found." },
+};
+
+// Pull-style producer for beginChunkedResponse(): next() stages the next
+// piece of output in src/srcLen, fill() copies it out in whatever sizes the
+// TCP stack asks for.
+struct ChunkSource {
+    const char* src = nullptr;  // bytes waiting to be copied out
+    size_t srcLen = 0;
+
+    virtual ~ChunkSource() {}
+    virtual bool next() = 0;    // Returns false when done
+
+    void setSrc(const char* p, size_t n) { src = p; srcLen = n; }
+
+    size_t fill(uint8_t* buf, size_t maxLen) {
+        size_t out = 0;
+        while (out < maxLen) {
+            if (srcLen == 0 && !next()) break;
+            size_t n = srcLen < maxLen - out ? srcLen : maxLen - out;
+            memcpy(buf + out, src, n);
+            out += n;
+            src += n;
+            srcLen -= n;
         }
-        request->send(file, fname, String(), true);
-    });
+        return out;
+    }
+};
 
-    // --- Download message file ---
-    server.on("^\\/messages\\/(.+)$", HTTP_GET, [](AsyncWebServerRequest* request) {
-        String fname = "/" + request->pathArg(0);
-        File file = SD_MMC.open("/messages" + fname);
-        if (!file || file.isDirectory()) {
-            request->send(404, "text/plain", "Message file not found");
-            return;
+static void sendChunked(AsyncWebServerRequest* request, std::shared_ptr<ChunkSource> st) {
+    AsyncWebServerResponse* response = request->beginChunkedResponse("text/html",
+        [st](uint8_t* buf, size_t maxLen, size_t) -> size_t {
+            return st->fill(buf, maxLen);
+        });
+    request->send(response);
+}
+
+struct ListState : ChunkSource {
+    enum Phase : uint8_t { Head, SectionStart, Rows, SectionEnd, Foot, Done } phase = Head;
+    uint8_t section = 0;
+    unsigned skipped = 0;   // rows of this section that didn't fit
+    File dir;
+    char text[LIST_NAME_ESC_MAX];
+    char url[LIST_NAME_ESC_MAX];
+    char row[LIST_ROW_MAX];
+
+    ~ListState() { if (dir) dir.close(); }
+
+    void setRow(int n) { setSrc(row, n < 0 ? 0 : (n >= (int)sizeof(row) ? sizeof(row) - 1 : n)); }
+
+    bool next() override {
+        const ListSection& S = LIST_SECTIONS[section];
+        switch (phase) {
+            case Head:
+                setSrc(FILEMAN_HEAD, sizeof(FILEMAN_HEAD) - 1);
+                phase = SectionStart;
+                return true;
+
+            case SectionStart:
+                dir = SD_MMC.open(S.dir);
+                setRow(snprintf(row, sizeof(row),
+                    "<h3>%s</h3><table class='filetbl'><tr><th>File</th><th>Size</th><th>Action</th></tr>%s%s%s",
+                    S.title, dir ? "" : "<tr><td colspan='3'><i>", dir ? "" : S.empty, dir ? "" : "</i></td></tr>"));
+                phase = dir ? Rows : SectionEnd;
+                return true;
+
+            case Rows:
+                for (;;) {
+                    File f;
+                    while ((f = dir.openNextFile()) && f.isDirectory()) f.close();
+                    if (!f) {
+                        dir.close();
+                        phase = SectionEnd;
+                        return next();
+                    }
+                    const char* name = f.name();
+                    const char* slash = strrchr(name, '/');
+                    if (slash) name = slash + 1;    // Trim prefix
+                    char size[16];
+                    humanSize(size, sizeof(size), f.size());
+                    int n = -1;
+                    if (htmlEscape(text, sizeof(text), name) && urlEncode(url, sizeof(url), name)) {
+                        n = snprintf(row, sizeof(row),
+                            "<tr><td><a href='/lb/fileman/view?type=%s&file=%s'>%s</a></td>"
+                            "<td>%s</td><td>"
+                            "<a class='btn' href='/lb/fileman/view?type=%s&file=%s'>View</a> "
+                            "<a class='btn' href='%s%s' download>Download</a> "
+                            "<a class='btn delbtn' href='/lb/fileman/delete?type=%s&file=%s' onclick=\"return confirm('Delete this %s?');\">Delete</a>"
+                            "</td></tr>",
+                            S.type, url, text, size, S.type, url, S.urlBase, url, S.type, url, S.noun);
+                    }
+                    f.close();
+                    if (n > 0 && n < (int)sizeof(row)) {
+                        setSrc(row, n);
+                        return true;
+                    }
+                    skipped++;      // A cut-off row would break the markup
+                }
+
+            case SectionEnd:
+                if (skipped) {
+                    setRow(snprintf(row, sizeof(row),
+                        "<tr><td colspan='3'><i>%u file(s) with names too long to list</i></td></tr></table>",
+                        skipped));
+                    skipped = 0;
+                } else {
+                    setSrc("</table>", 8);
+                }
+                phase = (++section < sizeof(LIST_SECTIONS) / sizeof(LIST_SECTIONS[0])) ? SectionStart : Foot;
+                return true;
+
+            case Foot:
+                setSrc(FILEMAN_FOOT, sizeof(FILEMAN_FOOT) - 1);
+                phase = Done;
+                return true;
+
+            default:
+                return false;
         }
-        request->send(file, fname, String(), true);
-    });
+    }
+};
 
-    // --- Themed file view ---
-    server.on("/lb/fileman/view", HTTP_GET, [](AsyncWebServerRequest* request) {
-        String type = request->hasParam("type") ? request->getParam("type")->value() : "";
-        String file = request->hasParam("file") ? request->getParam("file")->value() : "";
-        String html = R"rawliteral(
+// --- Streaming file view ---
+// The file is read in VIEW_READ_CHUNK pieces and HTML-escaped (and, for
+// type=json, re-indented) on the way out, so a view never holds more than
+// one chunk of the file in RAM.
+
+#define VIEW_READ_CHUNK   512
+#define VIEW_JSON_INDENT  16    // deepest level that still gets indented
+// Most row bytes one input byte can produce: after an opening bracket, a
+// ',' emits the pending newline and indent, itself, and a second newline
+// and indent. An entity (at most 6 bytes) never follows a newline pair.
+#define VIEW_STEP_MAX     (2 * (1 + 2 * VIEW_JSON_INDENT) + 8)
+
+static const char VIEW_HEAD[] = R"rawliteral(
 <!DOCTYPE html>
 <html>
 <head>
   <title>LoveByte File Viewer</title>
   <meta name="viewport" content="width=360, initial-scale=1">
-  <style>
-    body { background:#101016; color:#fff; font-family:sans-serif; text-align:center; margin:0; }
-    .logo { width:128px; margin:32px auto 20px auto; display:block; border-radius:16px; box-shadow:0 0 24px #2228; }
-    .btn { display:inline-block; margin:8px 4px; padding:12px 22px; background:#ff69b4; color:#fff; border:none; border-radius:10px; font-size:1.1em; font-weight:bold; cursor:pointer; transition:background .2s; box-shadow:0 2px 10px #0004;}
-    .btn:hover { background:#f032a8; }
-    .viewimg { max-width:90vw; max-height:60vh; margin:8px auto; border-radius:18px; box-shadow:0 0 24px #2228; display:block; }
-    .viewtxt { white-space:pre-wrap; text-align:left; margin:10px auto; width:90%; background:#181824; color:#eee; padding:14px; border-radius:9px;}
-  </style>
+  <link rel="stylesheet" href="/lb/style.css">
 </head>
 <body>
   <img class="logo" src="/res/splash.jpg" alt="LoveByte Logo">
 )rawliteral";
-        if (type == "image") {
-            html += "<h3>Image: " + file + "</h3>";
-            html += "<img class='viewimg' src='/images/" + file + "'>";
-        } else if (type == "text") {
-            File f = SD_MMC.open("/messages/" + file);
-            html += "<h3>Text File: " + file + "</h3>";
-            if (!f || f.isDirectory()) {
-                html += "<div class='viewtxt'>Unable to open file.</div>";
-            } else {
-                String content;
-                while (f.available()) content += (char)f.read();
-                html += "<div class='viewtxt'>" + content + "</div>";
-                f.close();
+
+static const char VIEW_FOOT[] =
+    "<br><button class='btn' onclick='history.back()'>&larr; Back</button>"
+    "<p class='foot'>&copy; Darkone83</p></body></html>";
+
+struct ViewState : ChunkSource {
+    enum Phase : uint8_t { Head, Title, Body, BodyEnd, Foot, Done } phase = Head;
+    enum Kind : uint8_t { Image, Text, Json } kind;
+    File f;
+    String name;
+    uint8_t in[VIEW_READ_CHUNK];
+    size_t inLen = 0, inPos = 0;
+    char row[1024];
+    size_t rowLen = 0;
+    // Pretty-printer state
+    uint8_t depth = 0;
+    bool inStr = false, strEsc = false, afterOpen = false;
+    uint32_t bytes = 0;
+    unsigned long t0 = millis();
+
+    ViewState(Kind k, const String& file) : kind(k), name(file) {
+        if (kind != Image) f = SD_MMC.open("/messages/" + file);
+    }
+    ~ViewState() { if (f) f.close(); }
+
+    void put(const char* s, size_t n) { memcpy(row + rowLen, s, n); rowLen += n; }
+    void putEsc(char c) {
+        switch (c) {
+            case '&':  put("&amp;", 5); break;
+            case '<':  put("&lt;", 4); break;
+            case '>':  put("&gt;", 4); break;
+            default:   row[rowLen++] = c;
+        }
+    }
+    void newline() {
+        row[rowLen++] = '\n';
+        for (uint8_t i = 0; i < depth && i < VIEW_JSON_INDENT; ++i) put("  ", 2);
+    }
+
+    void pretty(char c) {
+        if (inStr) {
+            putEsc(c);
+            if (strEsc) strEsc = false;
+            else if (c == '\\') strEsc = true;
+            else if (c == '"') inStr = false;
+            return;
+        }
+        if (c == ' ' || c == '\n' || c == '\r' || c == '\t') return;
+        bool closeOnNewLine = true;
+        if (afterOpen) {
+            afterOpen = false;
+            if (c == '}' || c == ']') closeOnNewLine = false;   // keep {} and [] together
+            else newline();
+        }
+        switch (c) {
+            case '{': case '[':
+                row[rowLen++] = c;
+                depth++;
+                afterOpen = true;
+                break;
+            case '}': case ']':
+                if (depth) depth--;
+                if (closeOnNewLine) newline();
+                row[rowLen++] = c;
+                break;
+            case ',': row[rowLen++] = ','; newline(); break;
+            case ':': put(": ", 2); break;
+            case '"': inStr = true; row[rowLen++] = c; break;
+            default:  putEsc(c);
+        }
+    }
+
+    bool next() override {
+        switch (phase) {
+            case Head:
+                setSrc(VIEW_HEAD, sizeof(VIEW_HEAD) - 1);
+                phase = Title;
+                return true;
+
+            case Title: {
+                char esc[256], url[256];
+                htmlEscape(esc, sizeof(esc), name.c_str());
+                urlEncode(url, sizeof(url), name.c_str());
+                int n;
+                if (kind == Image) {
+                    n = snprintf(row, sizeof(row),
+                        "<h3>Image: %s</h3><img class='viewimg' src='/images/%s'>", esc, url);
+                    phase = Foot;
+                } else if (!f || f.isDirectory()) {
+                    n = snprintf(row, sizeof(row),
+                        "<h3>Text File: %s</h3><div class='viewtxt'>Unable to open file.</div>", esc);
+                    phase = Foot;
+                } else {
+                    n = snprintf(row, sizeof(row),
+                        "<h3>%s: %s</h3><a class='btn alt' href='/lb/fileman/view?type=%s&file=%s'>%s</a>"
+                        "<div class='viewtxt'>",
+                        kind == Json ? "Message" : "Text File", esc,
+                        kind == Json ? "text" : "json", url, kind == Json ? "Raw" : "Pretty");
+                    phase = Body;
+                }
+                setSrc(row, n < 0 ? 0 : (n >= (int)sizeof(row) ? sizeof(row) - 1 : n));
+                return true;
             }
+
+            case Body:
+                if (inPos == inLen) {
+                    int n = f.read(in, sizeof(in));
+                    if (n <= 0) {
+                        phase = BodyEnd;
+                        return next();
+                    }
+                    inLen = n;
+                    inPos = 0;
+                    bytes += n;
+                }
+                rowLen = 0;
+                while (inPos < inLen && rowLen + VIEW_STEP_MAX < sizeof(row)) {
+                    char c = (char)in[inPos++];
+                    if (kind == Json) pretty(c);
+                    else putEsc(c);
+                }
+                setSrc(row, rowLen);
+                return true;
+
+            case BodyEnd:
+                Serial.printf("[FileView] %s: %u bytes in %lu ms\n",
+                    name.c_str(), (unsigned)bytes, millis() - t0);
+                setSrc("</div>", 6);
+                phase = Foot;
+                return true;
+
+            case Foot:
+                setSrc(VIEW_FOOT, sizeof(VIEW_FOOT) - 1);
+                phase = Done;
+                return true;
+
+            default:
+                return false;
         }
-        html += "<br><button class='btn' onclick='history.back()'>&larr; Back</button>";
-        html += "<p style='margin-top:2em;color:#ccc;font-size:.95em;'>&copy; Darkone83</p></body></html>";
-        request->send(200, "text/html", html);
-    });
+    }
+};
 
-    // --- Delete file (GET for simplicity) ---
-    server.on("/lb/fileman/delete", HTTP_GET, [](AsyncWebServerRequest* request) {
-        String type = request->hasParam("type") ? request->getParam("type")->value() : "";
-        String file = request->hasParam("file") ? request->getParam("file")->value() : "";
-        String path = (type == "image" ? "/images/" : "/messages/") + file;
-        bool ok = SD_MMC.remove(path);
-        String html = R"rawliteral(
+// --- Delete confirmation page ---
+// Built in a WebArena: the file name is the only variable part.
+
+static const char DELETE_HEAD[] = R"rawliteral(
 <!DOCTYPE html>
 <html>
 <head>
   <title>LoveByte File Delete</title>
   <meta name="viewport" content="width=360, initial-scale=1">
+  <meta http-equiv="refresh" content="2; url=/lb/fileman">
   <style>
     body { background:#101016; color:#fff; font-family:sans-serif; text-align:center; margin:0; }
     .logo { width:128px; margin:32px auto 20px auto; display:block; border-radius:16px; box-shadow:0 0 24px #2228; }
@@ -185,12 +404,130 @@ void setupFileManagerRoutes(AsyncWebServer& server) {
   <img class="logo" src="/res/splash.jpg" alt="LoveByte Logo">
   <h2>Delete File</h2>
 )rawliteral";
-        if (ok)
-            html += "<div class='viewtxt' style='color:#aef;'>Deleted: " + file + "</div>";
-        else
-            html += "<div class='viewtxt' style='color:#faa;'>Failed to delete: " + file + "</div>";
-        html += "<br><button class='btn' onclick='location.href=\"/lb/fileman\"'>Back to File Manager</button>";
-        html += "<p style='margin-top:2em;color:#ccc;font-size:.95em;'>&copy; Darkone83</p></body></html>";
-        request->send(200, "text/html", html);
+
+static const char DELETE_FOOT[] =
+    "<br><button class='btn' onclick='location.href=\"/lb/fileman\"'>Back to File Manager</button>"
+    "<p style='margin-top:2em;color:#ccc;font-size:.95em;'>&copy; Darkone83</p></body></html>";
+
+void setupFileManagerRoutes(AsyncWebServer& server) {
+    // --- Plain listing of everything (streamed; no-script fallback) ---
+    server.on("/lb/fileman/all", HTTP_GET, [](AsyncWebServerRequest* request) {
+        sendChunked(request, std::make_shared<ListState>());
+    });
+
+    // --- File index page: /api/files?dir=images&offset=0&limit=100&sort=-time&q=abc ---
+    server.on("/api/files", HTTP_GET, [](AsyncWebServerRequest* request) {
+        String dir = request->hasParam("dir") ? request->getParam("dir")->value() : "images";
+        uint32_t offset = request->hasParam("offset") ? request->getParam("offset")->value().toInt() : 0;
+        uint32_t limit = request->hasParam("limit") ? request->getParam("limit")->value().toInt() : FILES_PAGE_DEFAULT;
+        String sortArg = request->hasParam("sort") ? request->getParam("sort")->value() : "name";
+        String filter = request->hasParam("q") ? request->getParam("q")->value() : "";
+        if (limit == 0 || limit > FILES_PAGE_MAX) limit = FILES_PAGE_MAX;
+
+        bool desc = sortArg.startsWith("-");
+        if (desc) sortArg.remove(0, 1);
+        FileIndex::Sort sort = sortArg == "size" ? FileIndex::Sort::Size
+                             : sortArg == "time" ? FileIndex::Sort::Time
+                             : FileIndex::Sort::Name;
+
+        AsyncResponseStream* response = request->beginResponseStream("application/json");
+        if (!FileIndex::writePage(*response, dir, offset, limit, sort, desc, filter)) {
+            delete response;
+            request->send(503, "application/json", "{\"building\":true}");
+            return;
+        }
+        response->addHeader("Cache-Control", "no-store");
+        request->send(response);
+    });
+
+    // --- Image thumbnail; URLs carry ?v=<size>-<mtime>, so the file never changes ---
+    server.on("^\\/lb\\/thumb\\/(.+)$", HTTP_GET, [](AsyncWebServerRequest* request) {
+        String fname = request->pathArg(0);
+        if (fname.indexOf("..") >= 0 || fname.indexOf('/') >= 0) {
+            request->send(400, "text/plain", "Bad file name");
+            return;
+        }
+        String path = Thumbs::pathFor(fname);
+        if (SD_MMC.exists(path)) {
+            sendSdFile(request, path, CACHE_IMMUTABLE);
+            return;
+        }
+        if (Thumbs::failed(fname) || !SD_MMC.exists("/images/" + fname)) {
+            request->send(404, "text/plain", "No thumbnail");
+            return;
+        }
+        // Made by loop() shortly (or once the queue has room); the page retries
+        Thumbs::request(fname);
+        AsyncWebServerResponse* response = request->beginResponse(503, "text/plain", "Thumbnail pending");
+        response->addHeader("Retry-After", "1");
+        response->addHeader("Cache-Control", "no-store");
+        request->send(response);
+    });
+
+    // --- Thumbnail gallery of /images ---
+    server.on("/lb/gallery", HTTP_GET, [](AsyncWebServerRequest* request) {
+        serveAsset(request, ASSET_GALLERY_HTML);
+    });
+
+    // --- Download image file ---
+    server.on("^\\/images\\/(.+)$", HTTP_GET, [](AsyncWebServerRequest* request) {
+        String fname = request->pathArg(0);
+        if (fname.indexOf("..") >= 0) {
+            request->send(400, "text/plain", "Bad file name");
+            return;
+        }
+        sendSdFile(request, "/images/" + fname, CACHE_REVALIDATE, true);
+    });
+
+    // --- Download message file ---
+    server.on("^\\/messages\\/(.+)$", HTTP_GET, [](AsyncWebServerRequest* request) {
+        String fname = request->pathArg(0);
+        if (fname.indexOf("..") >= 0) {
+            request->send(400, "text/plain", "Bad file name");
+            return;
+        }
+        sendSdFile(request, "/messages/" + fname, CACHE_REVALIDATE, true);
+    });
+
+    // --- Themed file view (streamed): type=image|text|json ---
+    server.on("/lb/fileman/view", HTTP_GET, [](AsyncWebServerRequest* request) {
+        String type = request->hasParam("type") ? request->getParam("type")->value() : "";
+        String file = request->hasParam("file") ? request->getParam("file")->value() : "";
+        if (!file.length() || file.indexOf("..") >= 0 || file.indexOf('/') >= 0) {
+            request->send(400, "text/plain", "Bad file name");
+            return;
+        }
+        ViewState::Kind kind = type == "image" ? ViewState::Image
+                             : type == "json"  ? ViewState::Json
+                             : ViewState::Text;
+        sendChunked(request, std::make_shared<ViewState>(kind, file));
+    });
+
+    // --- Delete file (GET for simplicity) ---
+    server.on("/lb/fileman/delete", HTTP_GET, [](AsyncWebServerRequest* request) {
+        String type = request->hasParam("type") ? request->getParam("type")->value() : "";
+        String file = request->hasParam("file") ? request->getParam("file")->value() : "";
+        String path = (type == "image" ? "/images/" : "/messages/") + file;
+        // The main loop owns the SD card; it performs the removal
+        bool ok = file.length() && file.indexOf("..") < 0 &&
+                  DisplayOwner::post(DisplayOwner::Cmd::RemoveFile, path.c_str());
+        WebArena* page = WebArena::create();
+        if (!page) {
+            request->send(503, "text/plain", "Busy");
+            return;
+        }
+        page->print(DELETE_HEAD);
+        page->print(ok ? "<div class='viewtxt' style='color:#aef;'>Deleting: "
+                       : "<div class='viewtxt' style='color:#faa;'>Failed to delete: ");
+        page->html(file.c_str());
+        page->print("</div>");
+        page->print(DELETE_FOOT);
+        page->send(request, 200, "text/html");
+    });
+
+    // --- File Manager Main Page (client-side, pages through /api/files) ---
+    // Registered last: "/lb/fileman" also matches every "/lb/fileman/..." URL.
+    server.on("/lb/fileman", HTTP_GET, [](AsyncWebServerRequest* request) {
+        serveAsset(request, ASSET_FILEMAN_HTML);
     });
 }
@@ -0,0 +1,141 @@
+#include "web_static.h"
+#include <SD_MMC.h>
+#include <time.h>
+
+void serveAsset(AsyncWebServerRequest* request, const WebAsset& asset) {
+#if WEB_ASSET_TRACE
+    uint32_t t0 = micros();
+    size_t heap0 = ESP.getFreeHeap();
+#endif
+    AsyncWebServerResponse* response;
+    if (request->hasHeader("If-None-Match") &&
+        request->getHeader("If-None-Match")->value() == asset.etag) {
+        response = request->beginResponse(304);
+    } else {
+        response = request->beginResponse_P(200, asset.mime, asset.gz, asset.len);
+        response->addHeader("Content-Encoding", "gzip");
+    }
+    response->addHeader("ETag", asset.etag);
+    response->addHeader("Cache-Control", "no-cache");   // always revalidate, cheap 304
+    request->send(response);
+#if WEB_ASSET_TRACE
+    Serial.printf("[Web] %s -> %d bytes gz, heap delta %d, %lu us\n",
+        request->url().c_str(), (int)asset.len, (int)(heap0 - ESP.getFreeHeap()), micros() - t0);
+#endif
+}
+
+// --- SD card files ---
+
+static const char* mimeFor(const String& path) {
+    String p = path;
+    p.toLowerCase();
+    if (p.endsWith(".jpg") || p.endsWith(".jpeg")) return "image/jpeg";
+    if (p.endsWith(".gif")) return "image/gif";
+    if (p.endsWith(".png")) return "image/png";
+    if (p.endsWith(".bmp")) return "image/bmp";
+    if (p.endsWith(".json")) return "application/json";
+    if (p.endsWith(".txt")) return "text/plain";
+    return "application/octet-stream";
+}
+
+// Parse a single "bytes=a-b" / "bytes=a-" / "bytes=-n" range against size.
+// Returns 1 for a usable range, 0 to ignore the header, -1 if unsatisfiable.
+static int parseRange(const String& h, size_t size, size_t& start, size_t& end) {
+    if (!h.startsWith("bytes=") || h.indexOf(',') >= 0) return 0;   // multi-range: send it all
+    int dash = h.indexOf('-', 6);
+    if (dash < 0) return 0;
+    String a = h.substring(6, dash), b = h.substring(dash + 1);
+    a.trim(); b.trim();
+    if (!a.length()) {
+        if (!b.length()) return 0;
+        size_t n = strtoul(b.c_str(), nullptr, 10);
+        if (n == 0) return -1;
+        start = n >= size ? 0 : size - n;
+        end = size - 1;
+    } else {
+        start = strtoul(a.c_str(), nullptr, 10);
+        end = b.length() ? strtoul(b.c_str(), nullptr, 10) : size - 1;
+        if (end >= size) end = size - 1;
+        if (start >= size || start > end) return -1;
+    }
+    return 1;
+}
+
+void sendSdFile(AsyncWebServerRequest* request, const String& path,
+                const char* cacheControl, bool download) {
+    File file = SD_MMC.open(path, FILE_READ);
+    if (!file || file.isDirectory()) {
+        if (file) file.close();
+        request->send(404, "text/plain", "Not found");
+        return;
+    }
+    size_t size = file.size();
+    time_t mtime = file.getLastWrite();
+
+    char etag[32];
+    snprintf(etag, sizeof(etag), "\"%x-%lx\"", (unsigned)size, (unsigned long)mtime);
+    char lastMod[40] = "";
+    if (mtime > 0) {
+        struct tm tmv;
+        gmtime_r(&mtime, &tmv);
+        strftime(lastMod, sizeof(lastMod), "%a, %d %b %Y %H:%M:%S GMT", &tmv);
+    }
+
+    // Browsers echo our own Last-Modified back, so string equality is enough
+    bool fresh = request->hasHeader("If-None-Match")
+        ? request->getHeader("If-None-Match")->value() == etag
+        : (lastMod[0] && request->hasHeader("If-Modified-Since") &&
+           request->getHeader("If-Modified-Since")->value() == lastMod);
+
+    AsyncWebServerResponse* response;
+    if (fresh) {
+        file.close();
+        response = request->beginResponse(304);
+    } else {
+        size_t start = 0, end = 0;
+        int range = 0;
+        if (request->hasHeader("Range")) {
+            range = parseRange(request->getHeader("Range")->value(), size, start, end);
+            // If-Range: only honour the range if the client's copy is current
+            if (range && request->hasHeader("If-Range")) {
+                const String& ir = request->getHeader("If-Range")->value();
+                if (ir != etag && ir != lastMod) range = 0;
+            }
+        }
+
+        if (range < 0) {
+            file.close();
+            response = request->beginResponse(416);
+            char cr[32];
+            snprintf(cr, sizeof(cr), "bytes */%u", (unsigned)size);
+            response->addHeader("Content-Range", cr);
+            request->send(response);
+            return;
+        } else if (range > 0) {
+            size_t len = end - start + 1;
+            response = request->beginResponse(mimeFor(path), len,
+                [file, start, len](uint8_t* buf, size_t maxLen, size_t index) mutable -> size_t {
+                    if (index >= len) return 0;
+                    if ((size_t)file.position() != start + index) file.seek(start + index);
+                    size_t want = len - index < maxLen ? len - index : maxLen;
+                    int n = file.read(buf, want);
+                    return n > 0 ? n : 0;
+                });
+            response->setCode(206);
+            char cr[64];
+            snprintf(cr, sizeof(cr), "bytes %u-%u/%u", (unsigned)start, (unsigned)end, (unsigned)size);
+            response->addHeader("Content-Range", cr);
+            if (download) {
+                String name = path.substring(path.lastIndexOf('/') + 1);
+                response->addHeader("Content-Disposition", "attachment; filename=\"" + name + "\"");
+            }
+        } else {
+            response = request->beginResponse(file, path, mimeFor(path), download);
+        }
+        response->addHeader("Accept-Ranges", "bytes");
+    }
+    response->addHeader("ETag", etag);
+    if (lastMod[0]) response->addHeader("Last-Modified", lastMod);
+    response->addHeader("Cache-Control", cacheControl);
+    request->send(response);
+}
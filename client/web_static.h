@@ -0,0 +1,31 @@
+// web_static.h
+#pragma once
+#include <ESPAsyncWebServer.h>
+
+// A page or stylesheet gzipped at build time by tools/embed_web.py
+struct WebAsset {
+    const char* mime;
+    const uint8_t* gz;
+    size_t len;
+    const char* etag;   // quoted strong ETag
+};
+
+// Set to 1 to log heap use and time per asset response
+#ifndef WEB_ASSET_TRACE
+#define WEB_ASSET_TRACE 0
+#endif
+
+// Send the asset as-is with Content-Encoding: gzip, or 304 if the
+// browser's If-None-Match matches.
+void serveAsset(AsyncWebServerRequest* request, const WebAsset& asset);
+
+// Cache-Control policies for files served from the SD card
+#define CACHE_REVALIDATE  "no-cache"                             // may change; 304 when it hasn't
+#define CACHE_DAY         "public, max-age=86400"                // rarely changes (splash)
+#define CACHE_IMMUTABLE   "public, max-age=31536000, immutable"  // content never changes under this URL
+
+// Send an SD card file with ETag/Last-Modified validation (304), single
+// byte-range support (206/416) and the given Cache-Control. download=true
+// adds a Content-Disposition attachment header. Sends 404 if missing.
+void sendSdFile(AsyncWebServerRequest* request, const String& path,
+                const char* cacheControl, bool download = false);
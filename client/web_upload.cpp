@@ -0,0 +1,163 @@
+#include "web_upload.h"
+#include <SD_MMC.h>
+#include <esp_heap_caps.h>
+#include <time.h>
+#include "display_owner.h"
+#include "file_index.h"
+#include "thumbs.h"
+#include "metrics.h"
+#include "sd_stats.h"
+#include "web_arena.h"
+
+#define UPLOAD_DIR      "/images/.incoming"
+#define UPLOAD_CHUNK    (8 * 1024)              // bytes buffered per SD write
+#define UPLOAD_MAX      (8 * 1024 * 1024)
+
+// Lives in request->_tempObject, which the request free()s when it ends.
+// Uploads are the one SD writer outside loop(): the body arrives on the
+// AsyncTCP task, and handing it over would mean buffering all of it.
+struct UploadState {
+    char tmp[48];
+    char ext[6];
+    const char* error;
+    uint32_t written;
+    uint32_t fill;
+    uint8_t buf[UPLOAD_CHUNK];
+};
+
+static uint32_t uploadSeq = 0;
+
+static bool flushChunk(AsyncWebServerRequest* request, UploadState* st) {
+    if (!st->fill) return true;
+    unsigned long w0 = micros();
+    size_t n = request->_tempFile.write(st->buf, st->fill);
+    Metrics::observe(Metrics::Hist::SdWriteUs, micros() - w0);
+    if (n != st->fill) {
+        st->error = "SD write failed";
+        return false;
+    }
+    st->written += st->fill;
+    SdStats::added(st->fill);
+    st->fill = 0;
+    return true;
+}
+
+static void fail(AsyncWebServerRequest* request, UploadState* st, const char* why) {
+    st->error = why;
+    if (request->_tempFile) request->_tempFile.close();
+    SdStats::remove(st->tmp);
+}
+
+static void onUploadData(AsyncWebServerRequest* request, const String& filename,
+                         size_t index, uint8_t* data, size_t len, bool final) {
+    UploadState* st = (UploadState*)request->_tempObject;
+
+    if (index == 0) {
+        if (st) return;     // one file per request; ignore any others
+        st = (UploadState*)heap_caps_malloc(sizeof(UploadState), MALLOC_CAP_SPIRAM);
+        if (!st) st = (UploadState*)malloc(sizeof(UploadState));
+        if (!st) return;
+        request->_tempObject = st;
+        st->error = nullptr;
+        st->written = st->fill = 0;
+        snprintf(st->tmp, sizeof(st->tmp), UPLOAD_DIR "/%u.part", (unsigned)++uploadSeq);
+
+        String lower = filename;
+        lower.toLowerCase();
+        const char* ext = lower.endsWith(".gif") ? "gif"
+                        : (lower.endsWith(".jpg") || lower.endsWith(".jpeg")) ? "jpg" : nullptr;
+        strlcpy(st->ext, ext ? ext : "", sizeof(st->ext));
+        if (!ext) { st->error = "Only JPEG and GIF can be shown"; return; }
+        if (request->contentLength() > UPLOAD_MAX) { st->error = "File too large"; return; }
+        // Check the magic too, so a renamed PNG doesn't end up on the card
+        bool magicOk = len >= 4 && (ext[0] == 'g' ? !memcmp(data, "GIF8", 4) : (data[0] == 0xFF && data[1] == 0xD8));
+        if (!magicOk) { st->error = "Not a JPEG/GIF file"; return; }
+
+        if (!SD_MMC.exists(UPLOAD_DIR)) SD_MMC.mkdir(UPLOAD_DIR);
+        request->_tempFile = SD_MMC.open(st->tmp, FILE_WRITE);
+        if (!request->_tempFile) { st->error = "SD open failed"; return; }
+    }
+    if (!st || st->error) return;
+
+    while (len) {
+        size_t n = UPLOAD_CHUNK - st->fill < len ? UPLOAD_CHUNK - st->fill : len;
+        memcpy(st->buf + st->fill, data, n);
+        st->fill += n;
+        data += n;
+        len -= n;
+        if (st->fill == UPLOAD_CHUNK && !flushChunk(request, st)) {
+            fail(request, st, st->error);
+            return;
+        }
+    }
+
+    if (final) {
+        if (!flushChunk(request, st)) { fail(request, st, st->error); return; }
+        request->_tempFile.close();
+    }
+}
+
+static void onUploadDone(AsyncWebServerRequest* request) {
+    UploadState* st = (UploadState*)request->_tempObject;
+    if (!st) {
+        request->send(400, "application/json", "{\"error\":\"No file\"}");
+        return;
+    }
+    if (st->error || !st->written) {
+        if (request->_tempFile) request->_tempFile.close();
+        SdStats::remove(st->tmp);
+        WebArena* body = WebArena::create();
+        if (!body) {
+            request->send(400, "application/json", "{\"error\":\"Upload failed\"}");
+            return;
+        }
+        body->printf("{\"error\":\"%s\"}", st->error ? st->error : "Empty file");
+        body->send(request, 400, "application/json");
+        return;
+    }
+
+    // Same naming scheme as the server's uploads
+    char stamp[24];
+    time_t t = time(NULL);
+    strftime(stamp, sizeof(stamp), "%Y%m%d_%H%M%S", localtime(&t));
+    String name = String("img_") + stamp + "." + st->ext;
+    for (int n = 1; SD_MMC.exists("/images/" + name); ++n) {
+        name = String("img_") + stamp + "_" + n + "." + st->ext;
+    }
+    if (!SD_MMC.rename(st->tmp, "/images/" + name)) {
+        SdStats::remove(st->tmp);
+        request->send(500, "application/json", "{\"error\":\"SD rename failed\"}");
+        return;
+    }
+    FileIndex::invalidate("/images");
+    Thumbs::request(name);
+    Serial.printf("[Upload] %s: %u bytes\n", name.c_str(), (unsigned)st->written);
+
+    bool show = request->hasParam("show") && request->getParam("show")->value() == "1";
+    bool shown = show && DisplayOwner::post(DisplayOwner::Cmd::ShowImage, name.c_str());
+    WebArena* body = WebArena::create();
+    if (!body) {
+        request->send(200, "application/json", "{\"status\":\"uploaded\"}");
+        return;
+    }
+    body->printf("{\"status\":\"uploaded\",\"file\":\"%s\",\"shown\":%s}", name.c_str(), shown ? "true" : "false");
+    body->send(request, 200, "application/json");
+}
+
+void setupUploadRoutes(AsyncWebServer& server) {
+    // Leftovers from uploads cut off by a disconnect or reboot
+    File dir = SD_MMC.open(UPLOAD_DIR);
+    if (dir) {
+        File f;
+        while ((f = dir.openNextFile())) {
+            const char* name = f.name();
+            const char* slash = strrchr(name, '/');
+            String path = String(UPLOAD_DIR) + "/" + (slash ? slash + 1 : name);
+            f.close();
+            SD_MMC.remove(path);
+        }
+        dir.close();
+    }
+
+    server.on("/api/upload", HTTP_POST, onUploadDone, onUploadData);
+}
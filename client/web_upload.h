@@ -0,0 +1,6 @@
+#pragma once
+#include <ESPAsyncWebServer.h>
+
+// POST /api/upload[?show=1] (multipart, field "file"): stream a JPEG or GIF
+// straight to /images. Call after the SD card is mounted.
+void setupUploadRoutes(AsyncWebServer& server);
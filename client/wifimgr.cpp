@@ -5,7 +5,10 @@
 #include <FFat.h>
 #include <DNSServer.h>
 #include <esp_wifi.h>
+#include <algorithm>
 #include "led.h"   // PATCH: Add LED support
+#include "web_assets.h"
+#include "metrics.h"
 
 AsyncWebServer server(80);
 namespace WiFiMgr {
@@ -22,6 +25,89 @@ static const int maxAttempts = 10;
 static unsigned long lastAttempt = 0;
 static unsigned long retryDelay = 3000;
 
+// Last good association, kept in the "wifi" namespace next to the creds so
+// a reboot can skip the scan (and with a reused lease, DHCP) entirely
+struct Link {
+    bool valid;
+    uint8_t bssid[6];
+    uint8_t channel;
+    uint32_t ip, gw, mask, dns;
+    uint8_t leaseUses;      // boots the lease has been reused without DHCP
+};
+static Link link = {};
+static bool fastAttempt = false;
+static unsigned long connectStart = 0;
+static uint32_t lastConnectMs = 0;
+static unsigned long dropAt = 0;
+static bool dropRescan = false;
+
+// Scan results, filled by loop() from an async scan and read by /scan
+struct ScanEntry {
+    char ssid[33];
+    int8_t rssi;
+    bool open;
+};
+static portMUX_TYPE scanMux = portMUX_INITIALIZER_UNLOCKED;
+static ScanEntry scanCache[WIFI_SCAN_MAX];
+static uint8_t scanCount = 0;
+static unsigned long scanAt = 0;        // 0 = never
+static volatile bool scanWanted = false;
+static bool scanRunning = false;
+
+static void collectScan(int n) {
+    ScanEntry found[WIFI_SCAN_MAX];
+    uint8_t count = 0;
+    for (int i = 0; i < n; ++i) {
+        String s = WiFi.SSID(i);
+        if (!s.length()) continue;      // hidden
+        int8_t rssi = WiFi.RSSI(i);
+        // One row per SSID, keeping the strongest AP
+        int j = 0;
+        while (j < count && strcmp(found[j].ssid, s.c_str())) ++j;
+        if (j < count) {
+            if (rssi > found[j].rssi) found[j].rssi = rssi;
+            continue;
+        }
+        if (count == WIFI_SCAN_MAX) {
+            // Full: replace the weakest if this one is stronger
+            int weakest = 0;
+            for (int k = 1; k < count; ++k) if (found[k].rssi < found[weakest].rssi) weakest = k;
+            if (rssi <= found[weakest].rssi) continue;
+            j = weakest;
+        } else {
+            j = count++;
+        }
+        strlcpy(found[j].ssid, s.c_str(), sizeof(found[j].ssid));
+        found[j].rssi = rssi;
+        found[j].open = WiFi.encryptionType(i) == WIFI_AUTH_OPEN;
+    }
+    std::sort(found, found + count, [](const ScanEntry& a, const ScanEntry& b) { return a.rssi > b.rssi; });
+
+    portENTER_CRITICAL(&scanMux);
+    memcpy(scanCache, found, count * sizeof(ScanEntry));
+    scanCount = count;
+    scanAt = millis();
+    portEXIT_CRITICAL(&scanMux);
+    Serial.printf("[WiFiMgr] Scan: %d APs, %u networks\n", n, count);
+}
+
+// Starts an async scan when one was asked for, and collects it when done
+static void serviceScan() {
+    if (scanRunning) {
+        int n = WiFi.scanComplete();
+        if (n == WIFI_SCAN_RUNNING) return;
+        scanRunning = false;
+        if (n >= 0) collectScan(n);
+        else Serial.println("[WiFiMgr] Scan failed");
+        WiFi.scanDelete();
+        return;
+    }
+    // A scan hops channels, which would disturb an association in progress
+    if (!scanWanted || state == State::CONNECTING) return;
+    scanWanted = false;
+    scanRunning = WiFi.scanNetworks(true) == WIFI_SCAN_RUNNING;
+}
+
 static void setAPConfig() {
     WiFi.softAPConfig(
         IPAddress(192, 168, 4, 1),
@@ -30,6 +116,38 @@ static void setAPConfig() {
     );
 }
 
+static void loadLink() {
+    prefs.begin("wifi", true);
+    link.valid = prefs.getBytes("link", &link, sizeof(link)) == sizeof(link) && link.valid;
+    prefs.end();
+}
+
+// Only written when something changed, to spare the flash
+static void saveLink(bool fromDhcp) {
+    Link now;
+    memset(&now, 0, sizeof(now));       // compared bytewise below, padding too
+    now.valid = true;
+    memcpy(now.bssid, WiFi.BSSID(), 6);
+    now.channel = WiFi.channel();
+    now.ip = WiFi.localIP();
+    now.gw = WiFi.gatewayIP();
+    now.mask = WiFi.subnetMask();
+    now.dns = WiFi.dnsIP(0);
+    now.leaseUses = fromDhcp ? 0 : link.leaseUses;
+    if (link.valid && !memcmp(&now, &link, sizeof(now))) return;
+    link = now;
+    prefs.begin("wifi", false);
+    prefs.putBytes("link", &link, sizeof(link));
+    prefs.end();
+}
+
+static void clearLink() {
+    link.valid = false;
+    prefs.begin("wifi", false);
+    prefs.remove("link");
+    prefs.end();
+}
+
 void loadCreds() {
     prefs.begin("wifi", true);
     ssid = prefs.getString("ssid", "");
@@ -42,13 +160,43 @@ void saveCreds(const String& s, const String& p) {
     prefs.putString("ssid", s);
     prefs.putString("pass", p);
     prefs.end();
+    if (s != ssid) clearLink();     // cached link belongs to the old network
 }
 
 void clearCreds() {
     prefs.begin("wifi", false);
     prefs.remove("ssid");
     prefs.remove("pass");
+    prefs.remove("link");
     prefs.end();
+    link.valid = false;
+}
+
+// Fast: straight to the cached BSSID/channel, reusing the lease for up to
+// WIFI_LEASE_REUSE_MAX boots. Full: let the driver scan, and use DHCP.
+static void beginConnect(bool fast) {
+    fastAttempt = fast && link.valid;
+    bool staticIp = fastAttempt && WIFI_FAST_STATIC_IP && link.ip && link.leaseUses < WIFI_LEASE_REUSE_MAX;
+    if (staticIp) {
+        WiFi.config(IPAddress(link.ip), IPAddress(link.gw), IPAddress(link.mask), IPAddress(link.dns));
+    } else {
+        WiFi.config(IPAddress((uint32_t)0), IPAddress((uint32_t)0), IPAddress((uint32_t)0));
+    }
+    if (fastAttempt) {
+        WiFi.begin(ssid.c_str(), password.c_str(), link.channel, link.bssid, true);
+        link.leaseUses = staticIp ? link.leaseUses + 1 : 0;
+    } else {
+        WiFi.begin(ssid.c_str(), password.c_str());
+    }
+    lastAttempt = millis();
+}
+
+static void onConnected() {
+    lastConnectMs = millis() - connectStart;
+    Metrics::observe(Metrics::Hist::WifiConnectMs, lastConnectMs);
+    Serial.printf("[WiFiMgr] Connected in %lu ms (%s)\n", (unsigned long)lastConnectMs,
+        fastAttempt ? "cached BSSID" : "scan");
+    saveLink(!fastAttempt || link.leaseUses == 0);
 }
 
 void clearOnNotFound() {
@@ -86,97 +234,7 @@ void startPortal() {
     Led::setMode(LedMode::BreathePink);   // PATCH: Pink breathe in portal mode
 
     server.on("/", HTTP_GET, [](AsyncWebServerRequest *request){
-        String page = R"rawliteral(
-<!DOCTYPE html>
-<html>
-<head>
-    <title>WiFi Setup</title>
-    <meta name="viewport" content="width=320,initial-scale=1">
-    <style>
-        body {background:#111;color:#EEE;font-family:sans-serif;}
-        .container {max-width:320px;margin:24px auto;background:#222;padding:2em;border-radius:8px;box-shadow:0 0 16px #0008;}
-        input,select,button {width:100%;box-sizing:border-box;margin:.7em 0;padding:.5em;font-size:1.1em;border-radius:5px;border:1px solid #555;}
-        .btn-primary {background:#299a2c;color:white;}
-        .btn-danger {background:#a22;color:white;}
-        .status {margin-top:1em;font-size:.95em;}
-        label {display:block;margin-top:.5em;margin-bottom:.1em;}
-    </style>
-</head>
-<body>
-    <div class="container">
-        <div style="width:100%;text-align:center;margin-bottom:1em">
-            <span style="font-size:2em;font-weight:bold;">LoveByte Setup</span>
-        </div>
-        <form id="wifiForm">
-            <label>WiFi Network</label>
-            <select id="ssidDropdown" style="margin-bottom:1em;">
-                <option value="">Please select a network</option>
-            </select>
-            <input type="text" id="ssid" placeholder="SSID" style="margin-bottom:1em;">
-            <label>Password</label>
-            <input type="password" id="pass" placeholder="WiFi Password">
-            <button type="button" onclick="save()" class="btn-primary">Connect & Save</button>
-            <button type="button" onclick="forget()" class="btn-danger">Forget WiFi</button>
-        </form>
-        <div class="status" id="status">Status: ...</div>
-    </div>
-    <script>
-        function scan() {
-            fetch('/scan').then(r => r.json()).then(list => {
-                let dropdown = document.getElementById('ssidDropdown');
-                dropdown.innerHTML = '';
-                let defaultOpt = document.createElement('option');
-                defaultOpt.value = '';
-                defaultOpt.text = 'Please select a network';
-                dropdown.appendChild(defaultOpt);
-                list.forEach(ssid => {
-                    let opt = document.createElement('option');
-                    opt.value = ssid;
-                    opt.text = ssid;
-                    dropdown.appendChild(opt);
-                });
-                dropdown.onchange = function() {
-                    document.getElementById('ssid').value = dropdown.value;
-                };
-            }).catch(() => {
-                let dropdown = document.getElementById('ssidDropdown');
-                dropdown.innerHTML = '';
-                let opt = document.createElement('option');
-                opt.value = '';
-                opt.text = 'Scan failed';
-                dropdown.appendChild(opt);
-            });
-        }
-
-        // Initial scan, repeat every 2s
-        window.onload = scan;
-        setInterval(scan, 2000);
-
-        function save() {
-            let ssid = document.getElementById('ssid').value;
-            let pass = document.getElementById('pass').value;
-            fetch('/save', {
-                method: 'POST',
-                headers: {'Content-Type': 'application/json'},
-                body: JSON.stringify({ssid:ssid,pass:pass})
-            }).then(r => r.text()).then(t => {
-                document.getElementById('status').innerText = t;
-            });
-        }
-
-        function forget() {
-            fetch('/forget').then(r => r.text()).then(t => {
-                document.getElementById('status').innerText = t;
-                document.getElementById('ssid').value = '';
-                document.getElementById('pass').value = '';
-            });
-        }
-    </script>
-</body>
-</html>
-        )rawliteral";
-
-        request->send(200, "text/html", page);
+        serveAsset(request, ASSET_PORTAL_HTML);
     });
 
     server.on("/status", HTTP_GET, [](AsyncWebServerRequest *request){
@@ -203,7 +261,8 @@ void startPortal() {
         password = pw;
         state = State::CONNECTING;
         connectAttempts = 1;
-        WiFi.begin(ssid.c_str(), password.c_str());
+        connectStart = millis();
+        beginConnect(false);
         Led::setMode(LedMode::BootBlink);    // PATCH: Blink while connecting
         request->send(200, "text/plain", "Connecting to: " + ssid);
     });
@@ -228,15 +287,31 @@ void startPortal() {
         request->send(200, "text/plain", "WiFi credentials cleared (debug).");
     });
 
+    // Answers from the cache at once; a stale cache also queues a rescan
     server.on("/scan", HTTP_GET, [](AsyncWebServerRequest *request){
-        int n = WiFi.scanNetworks();
-        String json = "[";
-        for (int i = 0; i < n; ++i) {
-            if (i) json += ",";
-            json += "\"" + WiFi.SSID(i) + "\"";
+        ScanEntry list[WIFI_SCAN_MAX];
+        portENTER_CRITICAL(&scanMux);
+        uint8_t n = scanCount;
+        memcpy(list, scanCache, n * sizeof(ScanEntry));
+        unsigned long at = scanAt;
+        portEXIT_CRITICAL(&scanMux);
+
+        bool stale = !at || millis() - at > WIFI_SCAN_MAX_AGE;
+        if (stale) scanWanted = true;
+
+        AsyncResponseStream* response = request->beginResponseStream("application/json");
+        response->printf("{\"age\":%ld,\"scanning\":%s,\"networks\":[",
+            at ? (long)((millis() - at) / 1000) : -1L, (scanRunning || stale) ? "true" : "false");
+        for (uint8_t i = 0; i < n; ++i) {
+            response->print(i ? ",{\"ssid\":\"" : "{\"ssid\":\"");
+            for (const char* c = list[i].ssid; *c; ++c) {
+                if (*c == '"' || *c == '\\') response->print('\\');
+                if ((uint8_t)*c >= 0x20) response->print(*c);
+            }
+            response->printf("\",\"rssi\":%d,\"open\":%s}", list[i].rssi, list[i].open ? "true" : "false");
         }
-        json += "]";
-        request->send(200, "application/json", json);
+        response->print("]}");
+        request->send(response);
     });
 
     server.on("/save", HTTP_POST, [](AsyncWebServerRequest *request){},
@@ -271,7 +346,8 @@ void startPortal() {
         password = pw;
         state = State::CONNECTING;
         connectAttempts = 1;
-        WiFi.begin(ssid.c_str(), password.c_str());
+        connectStart = millis();
+        beginConnect(false);
         Led::setMode(LedMode::BootBlink); // PATCH: blink while connecting
         request->send(200, "text/plain", "Connecting to: " + ssid);
     }
@@ -302,10 +378,10 @@ void tryConnect() {
     if (ssid.length() > 0) {
         WiFi.mode(WIFI_AP_STA);
         delay(100);
-        WiFi.begin(ssid.c_str(), password.c_str());
+        connectStart = millis();
+        beginConnect(true);
         state = State::CONNECTING;
         connectAttempts = 1;
-        lastAttempt = millis();
         Led::setMode(LedMode::BootBlink); // PATCH: blink while trying to connect
     } else {
         startPortal();
@@ -314,13 +390,17 @@ void tryConnect() {
 
 void begin() {
     loadCreds();
+    loadLink();
     startPortal();
     if (ssid.length() > 0)
         tryConnect();
+    else
+        scanWanted = true;      // have the list ready when the portal opens
 }
 
 void loop() {
     dnsServer.processNextRequest();
+    serviceScan();
     if (state == State::CONNECTING) {
         if (WiFi.status() == WL_CONNECTED) {
             state = State::CONNECTED;
@@ -330,21 +410,49 @@ void loop() {
             Serial.println("[WiFiMgr] WiFi connected.");
             Serial.print("[WiFiMgr] IP Address: ");
             Serial.println(WiFi.localIP());
+            onConnected();
+        } else if (fastAttempt && millis() - lastAttempt > WIFI_FAST_TIMEOUT) {
+            // AP moved or lease refused: fall back to a normal scan + DHCP
+            Serial.println("[WiFiMgr] Cached BSSID failed, scanning");
+            WiFi.disconnect();
+            beginConnect(false);
         } else if (millis() - lastAttempt > retryDelay) {
             connectAttempts++;
             if (connectAttempts >= maxAttempts) {
                 state = State::PORTAL;
                 startPortal();
+                scanWanted = true;
             } else {
                 WiFi.disconnect();
-                WiFi.begin(ssid.c_str(), password.c_str());
-                lastAttempt = millis();
+                beginConnect(false);
                 Led::setMode(LedMode::BootBlink); // PATCH: blink while retrying
             }
         }
+    } else if (state == State::CONNECTED) {
+        // Brief drops are left to the driver's auto-reconnect (same BSSID);
+        // if it drags on, unpin the BSSID and let it scan
+        if (WiFi.status() != WL_CONNECTED) {
+            if (!dropAt) {
+                dropAt = millis();
+            } else if (!dropRescan && millis() - dropAt > WIFI_DROP_RESCAN_MS) {
+                dropRescan = true;
+                WiFi.disconnect();
+                beginConnect(false);
+            }
+        } else if (dropAt) {
+            connectStart = dropAt;
+            fastAttempt = !dropRescan;
+            dropAt = 0;
+            dropRescan = false;
+            onConnected();
+        }
     }
 }
 
+uint32_t connectMs() {
+    return lastConnectMs;
+}
+
 void restartPortal() {
     startPortal();
 }
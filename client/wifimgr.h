@@ -2,6 +2,14 @@
 
 #include <Arduino.h>
 
+#define WIFI_SCAN_MAX       24      // networks kept, strongest first
+#define WIFI_SCAN_MAX_AGE   15000   // /scan asks for a fresh scan past this, ms
+
+#define WIFI_FAST_TIMEOUT       1500    // cached-BSSID attempt before a full scan, ms
+#define WIFI_FAST_STATIC_IP     1       // reuse the last DHCP lease on the fast path
+#define WIFI_LEASE_REUSE_MAX    8       // boots on a reused lease before DHCP again
+#define WIFI_DROP_RESCAN_MS     10000   // drop length before unpinning the BSSID
+
 namespace WiFiMgr {
 
     //AsyncWebServer& getServer();
@@ -12,4 +20,5 @@ namespace WiFiMgr {
     void forgetWiFi();
     bool isConnected();
     String getStatus();
+    uint32_t connectMs();   // duration of the last (re)connect, 0 before the first
 }
@@ -100,6 +100,9 @@ def push():
         'heartbeatColor': hbcolor,
         'heartbeatPulses': int(data.get('heartbeatPulses', 0))
     }
+    # Keyframe LED effect: an inline track object or the name of an SD effect
+    if data.get('ledFx'):
+        msg['ledFx'] = data.get('ledFx')
     print(f"[PUSH] Appending message to '{recipient}': {msg}")
     devices[recipient]['messages'].append(msg)
     message_queue.put({'action': 'log', 'msg': f"Sent to {recipient}: {msg['text']} (as message)"})